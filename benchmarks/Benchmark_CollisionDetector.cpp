@@ -0,0 +1,140 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/physics/CollisionDetector.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace mighter2d;
+using namespace mighter2d::priv;
+
+namespace {
+    const std::size_t BOX_COUNT = 10000;
+    const std::size_t PAIR_COUNT = 100000;
+    const int REPETITIONS = 200;
+
+    // Prevents the compiler from optimizing away the measured work
+    volatile unsigned int sink = 0;
+
+    template <typename Function>
+    double measure(Function&& function) {
+        auto start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < REPETITIONS; i++)
+            function();
+
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / REPETITIONS;
+    }
+
+    const char* getName(CollisionDetector::InstructionSet instructionSet) {
+        switch (instructionSet) {
+            case CollisionDetector::InstructionSet::SSE2:
+                return "SSE2";
+            case CollisionDetector::InstructionSet::AVX2:
+                return "AVX2";
+            default:
+                return "Scalar";
+        }
+    }
+}
+
+int main() {
+    std::mt19937 engine(2022);
+    std::uniform_real_distribution<float> position(0.0f, 2000.0f);
+    std::uniform_real_distribution<float> size(1.0f, 64.0f);
+    std::uniform_int_distribution<Uint32> index(0, BOX_COUNT - 1);
+
+    std::vector<BoundingBox> boxes;
+    BoundingBoxBuffer buffer;
+
+    for (std::size_t i = 0; i < BOX_COUNT; i++) {
+        boxes.emplace_back(Vector2f{position(engine), position(engine)}, Vector2f{size(engine), size(engine)});
+        buffer.add(boxes.back());
+    }
+
+    std::vector<Uint32> indicesA(PAIR_COUNT), indicesB(PAIR_COUNT);
+    for (std::size_t i = 0; i < PAIR_COUNT; i++) {
+        indicesA[i] = index(engine);
+        indicesB[i] = index(engine);
+    }
+
+    std::vector<Uint8> results(PAIR_COUNT);
+    std::vector<float> IoUs(PAIR_COUNT);
+    const BoundingBox& probe = boxes.front();
+
+    std::printf("%zu bounding boxes, %zu pairs, best instruction set: %s\n\n", BOX_COUNT, PAIR_COUNT,
+        getName(CollisionDetector::getBestInstructionSet()));
+
+    // Baseline: one function call per bounding box
+    double oneVsManyBaseline = measure([&] {
+        for (std::size_t i = 0; i < BOX_COUNT; i++)
+            results[i] = CollisionDetector::isColliding(probe, boxes[i]);
+
+        sink = sink + results[BOX_COUNT - 1];
+    });
+
+    double pairsBaseline = measure([&] {
+        for (std::size_t i = 0; i < PAIR_COUNT; i++) {
+            const BoundingBox& boxA = boxes[indicesA[i]];
+            const BoundingBox& boxB = boxes[indicesB[i]];
+            results[i] = CollisionDetector::isColliding(boxA, boxB);
+            IoUs[i] = results[i] ? CollisionDetector::getIoU(boxA, boxB) : 0.0f;
+        }
+
+        sink = sink + results[PAIR_COUNT - 1];
+    });
+
+    std::printf("%-12s %14s %14s\n", "", "one-vs-N (ms)", "pairs (ms)");
+    std::printf("%-12s %14.4f %14.4f\n", "Per pair", oneVsManyBaseline, pairsBaseline);
+
+    const CollisionDetector::InstructionSet instructionSets[] = {
+        CollisionDetector::InstructionSet::Scalar,
+        CollisionDetector::InstructionSet::SSE2,
+        CollisionDetector::InstructionSet::AVX2
+    };
+
+    for (auto instructionSet : instructionSets) {
+        if (instructionSet > CollisionDetector::getBestInstructionSet())
+            break;
+
+        CollisionDetector::setInstructionSet(instructionSet);
+
+        double oneVsMany = measure([&] {
+            CollisionDetector::isColliding(probe, buffer, results.data());
+            sink = sink + results[BOX_COUNT - 1];
+        });
+
+        double pairs = measure([&] {
+            CollisionDetector::testPairs(buffer, indicesA.data(), indicesB.data(), PAIR_COUNT, results.data(), IoUs.data());
+            sink = sink + results[PAIR_COUNT - 1];
+        });
+
+        std::printf("%-12s %14.4f %14.4f\n", getName(instructionSet), oneVsMany, pairs);
+    }
+
+    return 0;
+}
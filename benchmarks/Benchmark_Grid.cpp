@@ -0,0 +1,120 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/scene/Scene.h"
+#include "Mighter2d/core/grid/Grid.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace mighter2d;
+
+namespace {
+    // Prevents the compiler from optimizing away the measured work
+    volatile int sink = 0;
+
+    template <typename Function>
+    double measureNanoseconds(std::size_t repetitions, Function&& function) {
+        auto start = std::chrono::steady_clock::now();
+
+        for (std::size_t i = 0; i < repetitions; i++)
+            function(i);
+
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / static_cast<double>(repetitions);
+    }
+
+    // The lookup Grid::getTile(const Vector2f&) used to perform. The bounds of each
+    // tile are computed rather than requested from the grid, because getTile(Index)
+    // creates the tiles of a streamed grid on demand and would allocate every tile
+    Index findTileByScanning(const Grid& grid, const Vector2f& position) {
+        const Vector2f gridPosition = grid.getPosition();
+        const Vector2u tileSize = grid.getTileSize();
+        const unsigned int spacing = grid.getSpaceBetweenTiles();
+
+        for (unsigned int row = 0; row < grid.getRowCount(); row++) {
+            for (unsigned int colm = 0; colm < grid.getColumnCount(); colm++) {
+                // Same bounds as Tile::contains
+                float left = gridPosition.x + static_cast<float>(spacing + colm * (tileSize.x + spacing));
+                float top = gridPosition.y + static_cast<float>(spacing + row * (tileSize.y + spacing));
+                float right = left + static_cast<float>(tileSize.x);
+                float bottom = top + static_cast<float>(tileSize.y);
+
+                if (position.x >= left && position.x <= right && position.y >= top && position.y <= bottom)
+                    return {static_cast<int>(row), static_cast<int>(colm)};
+            }
+        }
+
+        return {-1, -1};
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const unsigned int size = argc > 1 ? static_cast<unsigned int>(std::strtoul(argv[1], nullptr, 10)) : 1000u;
+    const std::size_t LOOKUP_COUNT = 1000000;
+    const std::size_t SCAN_COUNT = 20;
+
+    Scene scene;
+    Grid grid(32, 32, scene);
+    grid.setPosition(100, 50);
+
+    auto start = std::chrono::steady_clock::now();
+    grid.construct({size, size}, '.');
+    std::chrono::duration<double, std::milli> constructTime = std::chrono::steady_clock::now() - start;
+
+    std::printf("%ux%u grid constructed in %.1f ms\n", size, size, constructTime.count());
+
+    // Positions anywhere in (and slightly around) the grid, including the space between tiles
+    std::mt19937 engine(2022);
+    std::uniform_real_distribution<float> x(grid.getPosition().x - 16.0f, grid.getPosition().x + static_cast<float>(grid.getSize().x) + 16.0f);
+    std::uniform_real_distribution<float> y(grid.getPosition().y - 16.0f, grid.getPosition().y + static_cast<float>(grid.getSize().y) + 16.0f);
+
+    std::vector<Vector2f> positions(LOOKUP_COUNT);
+    for (auto& position : positions)
+        position = {x(engine), y(engine)};
+
+    // Both lookups must agree
+    for (std::size_t i = 0; i < SCAN_COUNT; i++) {
+        if (grid.getTile(positions[i]).getIndex() != findTileByScanning(grid, positions[i])) {
+            std::printf("Mismatch at (%f, %f)\n", static_cast<double>(positions[i].x), static_cast<double>(positions[i].y));
+            return EXIT_FAILURE;
+        }
+    }
+
+    double lookupTime = measureNanoseconds(LOOKUP_COUNT, [&](std::size_t i) {
+        sink = sink + grid.getTile(positions[i]).getIndex().row;
+    });
+
+    double scanTime = measureNanoseconds(SCAN_COUNT, [&](std::size_t i) {
+        sink = sink + findTileByScanning(grid, positions[i]).row;
+    });
+
+    std::printf("%-28s %14.1f ns\n", "getTile(Vector2f)", lookupTime);
+    std::printf("%-28s %14.1f ns\n", "Scan of every tile", scanTime);
+    std::printf("Speedup: %.0fx\n", scanTime / lookupTime);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,179 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/grid/GridParser.h"
+#include "Mighter2d/core/grid/TileStorage.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+
+using namespace mighter2d;
+
+namespace {
+    const int REPETITIONS = 5;
+    const char* TEXT_FILENAME = "Benchmark_GridParser.txt";
+    const char* BINARY_FILENAME = "Benchmark_GridParser.bin";
+    const char* CRLF_FILENAME = "Benchmark_GridParser_CRLF.txt";
+
+    // Prevents the compiler from optimizing away the measured work
+    volatile int sink = 0;
+
+    template <typename Function>
+    double measure(Function&& function) {
+        auto start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < REPETITIONS; i++)
+            function();
+
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / REPETITIONS;
+    }
+
+    // The parse GridParser::parse used to perform
+    GridParser::Map parseWithStream(const std::string& filename, char separator) {
+        GridParser::Map map;
+        std::ifstream file(filename);
+        std::stringstream mapData;
+        mapData << file.rdbuf();
+        std::string line;
+
+        while (std::getline(mapData, line)) {
+            if (line.empty() || line[0] == '#')
+                continue;
+
+            std::vector<char> row;
+            for (const auto& character : line) {
+                if (character != separator)
+                    row.push_back(character);
+            }
+            map.push_back(row);
+        }
+
+        return map;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const unsigned int size = argc > 1 ? static_cast<unsigned int>(std::strtoul(argv[1], nullptr, 10)) : 4096u;
+
+    // A text map with a separator between tiles, like the maps shipped with games
+    {
+        std::mt19937 engine(2022);
+        std::ofstream file(TEXT_FILENAME);
+        std::string row(size * 2 - 1, ',');
+        for (auto i = 0u; i < size; i++) {
+            for (auto j = 0u; j < size; j++)
+                row[j * 2] = "..XO"[engine() % 4];
+
+            file << row << '\n';
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    GridParser::writeBinary(GridParser::parse(TEXT_FILENAME, ','), BINARY_FILENAME);
+    std::chrono::duration<double, std::milli> convertTime = std::chrono::steady_clock::now() - start;
+    std::printf("%ux%u map converted to binary in %.1f ms\n", size, size, convertTime.count());
+
+    // Every load must produce the same tiles
+    {
+        auto map = parseWithStream(TEXT_FILENAME, ',');
+        priv::TileStorage tiles;
+        tiles.open(BINARY_FILENAME, '\0', false);
+
+        if (GridParser::parse(TEXT_FILENAME, ',') != map) {
+            std::printf("Mismatch between the text parsers\n");
+            return EXIT_FAILURE;
+        }
+
+        for (auto i = 0u; i < size; i++) {
+            for (auto j = 0u; j < size; j++) {
+                if (tiles.getId({static_cast<int>(i), static_cast<int>(j)}) != map[i][j]) {
+                    std::printf("Mismatch at (%u, %u)\n", i, j);
+                    return EXIT_FAILURE;
+                }
+            }
+        }
+    }
+
+    // Maps saved with Windows line endings must load the same tiles, streamed or not
+    {
+        std::ofstream(CRLF_FILENAME, std::ios::binary) << "# Comment\r\n.,X\r\n\r\nO,.\r\n";
+        const GridParser::Map expected = {{'.', 'X'}, {'O', '.'}};
+        priv::TileStorage tiles;
+        tiles.open(CRLF_FILENAME, ',', true);
+
+        bool isMatching = GridParser::parse(CRLF_FILENAME, ',') == expected
+            && tiles.getRowCount() == expected.size() && tiles.getColumnCount() == expected[0].size();
+
+        for (auto i = 0u; isMatching && i < expected.size(); i++) {
+            for (auto j = 0u; isMatching && j < expected[i].size(); j++)
+                isMatching = tiles.getId({static_cast<int>(i), static_cast<int>(j)}) == expected[i][j];
+        }
+
+        std::remove(CRLF_FILENAME);
+
+        if (!isMatching) {
+            std::printf("Mismatch in a map with CRLF line endings\n");
+            return EXIT_FAILURE;
+        }
+    }
+
+    double streamParseTime = measure([] {
+        sink = sink + static_cast<int>(parseWithStream(TEXT_FILENAME, ',').size());
+    });
+
+    double parseTime = measure([] {
+        sink = sink + static_cast<int>(GridParser::parse(TEXT_FILENAME, ',').size());
+    });
+
+    double binaryOpenTime = measure([] {
+        priv::TileStorage tiles;
+        tiles.open(BINARY_FILENAME, '\0', false);
+        sink = sink + static_cast<int>(tiles.getRowCount());
+    });
+
+    double binaryReadTime = measure([size] {
+        priv::TileStorage tiles;
+        tiles.open(BINARY_FILENAME, '\0', false);
+
+        for (auto i = 0; i < static_cast<int>(size); i++) {
+            for (auto j = 0; j < static_cast<int>(size); j++)
+                sink = sink + tiles.getId({i, j});
+        }
+    });
+
+    std::printf("%-36s %10.2f ms\n", "Text, stringstream parse (before)", streamParseTime);
+    std::printf("%-36s %10.2f ms\n", "Text, memory-mapped parse", parseTime);
+    std::printf("%-36s %10.2f ms\n", "Binary, memory-mapped load", binaryOpenTime);
+    std::printf("%-36s %10.2f ms\n", "Binary, load and read every tile", binaryReadTime);
+
+    std::remove(TEXT_FILENAME);
+    std::remove(BINARY_FILENAME);
+
+    return EXIT_SUCCESS;
+}
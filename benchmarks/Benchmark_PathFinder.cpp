@@ -0,0 +1,130 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/scene/Scene.h"
+#include "Mighter2d/core/grid/Grid.h"
+#include "Mighter2d/core/grid/FlowField.h"
+#include "Mighter2d/core/physics/path/AStar.h"
+#include "Mighter2d/core/physics/path/BFS.h"
+#include "Mighter2d/core/physics/path/HPAStar.h"
+#include "Mighter2d/core/physics/path/JPS.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace mighter2d;
+
+namespace {
+    struct Result {
+        double milliseconds = 0.0;  // Average time per path
+        std::size_t pathLength = 0; // Total length of the found paths
+    };
+
+    Result measure(IPathFinderStrategy& pathFinder, const Grid& grid, const std::vector<std::pair<Index, Index>>& queries) {
+        Result result;
+        auto start = std::chrono::steady_clock::now();
+
+        for (const auto& [source, target] : queries)
+            result.pathLength += pathFinder.findPath(grid, source, target).size();
+
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        result.milliseconds = elapsed.count() / static_cast<double>(queries.size());
+        return result;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    // BFS explores most of the grid for every path, so keep the default grid small
+    const unsigned int size = argc > 1 ? static_cast<unsigned int>(std::strtoul(argv[1], nullptr, 10)) : 64u;
+    const std::size_t QUERY_COUNT = 50;
+    const int OBSTACLE_PERCENTAGE = 20;
+
+    Scene scene;
+    Grid grid(32, 32, scene);
+    grid.construct({size, size}, '.');
+
+    std::mt19937 engine(2022);
+    std::uniform_int_distribution<int> percentage(0, 99);
+    std::uniform_int_distribution<int> coordinate(0, static_cast<int>(size) - 1);
+
+    for (int row = 0; row < static_cast<int>(size); row++) {
+        for (int colm = 0; colm < static_cast<int>(size); colm++) {
+            if (percentage(engine) < OBSTACLE_PERCENTAGE)
+                grid.setCollidableByIndex(Index{row, colm}, true);
+        }
+    }
+
+    std::vector<std::pair<Index, Index>> queries;
+    while (queries.size() < QUERY_COUNT) {
+        Index source{coordinate(engine), coordinate(engine)};
+        Index target{coordinate(engine), coordinate(engine)};
+
+        if (!grid.isCollidable(source) && !grid.isCollidable(target))
+            queries.emplace_back(source, target);
+    }
+
+    BFS bfs(grid.getSizeInTiles());
+    AStar aStar(grid.getSizeInTiles());
+    JPS jps(grid.getSizeInTiles());
+    HPAStar hpaStar(grid.getSizeInTiles());
+
+    Result bfsResult = measure(bfs, grid, queries);
+    Result aStarResult = measure(aStar, grid, queries);
+    Result jpsResult = measure(jps, grid, queries);
+
+    // The first path builds the clusters, measure it separately from the rest
+    auto buildStart = std::chrono::steady_clock::now();
+    hpaStar.findPath(grid, queries.front().first, queries.front().second);
+    std::chrono::duration<double, std::milli> buildTime = std::chrono::steady_clock::now() - buildStart;
+    Result hpaStarResult = measure(hpaStar, grid, queries);
+
+    // Every source follows the flow field of the first target, one tile at a time
+    const Index destination = queries.front().second;
+    auto flowFieldStart = std::chrono::steady_clock::now();
+    FlowField& flowField = grid.getFlowField(destination);
+    std::chrono::duration<double, std::milli> flowFieldBuildTime = std::chrono::steady_clock::now() - flowFieldStart;
+
+    std::size_t flowFieldSteps = 0;
+    flowFieldStart = std::chrono::steady_clock::now();
+    for (const auto& query : queries) {
+        for (Index tile = flowField.getNextTile(query.first); tile != Index{-1, -1}; tile = flowField.getNextTile(tile))
+            flowFieldSteps++;
+    }
+    std::chrono::duration<double, std::milli> flowFieldTime = std::chrono::steady_clock::now() - flowFieldStart;
+
+    std::printf("%ux%u grid, %d%% collidable tiles, %zu paths\n", size, size, OBSTACLE_PERCENTAGE, QUERY_COUNT);
+    std::printf("%-8s %12.3f ms/path %10zu tiles in paths\n", "BFS", bfsResult.milliseconds, bfsResult.pathLength);
+    std::printf("%-8s %12.3f ms/path %10zu tiles in paths\n", "AStar", aStarResult.milliseconds, aStarResult.pathLength);
+    std::printf("%-8s %12.3f ms/path %10zu tiles in paths\n", "JPS", jpsResult.milliseconds, jpsResult.pathLength);
+    std::printf("%-8s %12.3f ms/path %10zu tiles in paths (%.1f ms to build the clusters)\n", "HPAStar",
+        hpaStarResult.milliseconds, hpaStarResult.pathLength, buildTime.count());
+    std::printf("%-8s %12.3f ms/path %10zu tiles in paths (%.1f ms to build the field, one destination)\n", "FlowField",
+        flowFieldTime.count() / static_cast<double>(queries.size()), flowFieldSteps, flowFieldBuildTime.count());
+    std::printf("Speedup: AStar %.0fx, JPS %.0fx, HPAStar %.0fx\n", bfsResult.milliseconds / aStarResult.milliseconds,
+        bfsResult.milliseconds / jpsResult.milliseconds, bfsResult.milliseconds / hpaStarResult.milliseconds);
+
+    return EXIT_SUCCESS;
+}
@@ -50,8 +50,13 @@
 #include "Mighter2d/core/input/Keyboard.h"
 #include "Mighter2d/core/input/Joystick.h"
 #include "Mighter2d/core/engine/Engine.h"
+#include "Mighter2d/core/physics/path/AStar.h"
 #include "Mighter2d/core/physics/path/BFS.h"
 #include "Mighter2d/core/physics/path/DFS.h"
+#include "Mighter2d/core/physics/path/HPAStar.h"
+#include "Mighter2d/core/physics/path/JPS.h"
+#include "Mighter2d/core/physics/path/PathCache.h"
+#include "Mighter2d/core/physics/path/PathService.h"
 #include "Mighter2d/core/physics/GridMover.h"
 #include "Mighter2d/core/physics/KeyboardGridMover.h"
 #include "Mighter2d/core/physics/RandomGridMover.h"
@@ -62,6 +67,7 @@
 #include "Mighter2d/core/scene/BackgroundScene.h"
 #include "Mighter2d/core/grid/Index.h"
 #include "Mighter2d/core/grid/Grid.h"
+#include "Mighter2d/core/grid/FlowField.h"
 #include "Mighter2d/core/time/Clock.h"
 #include "Mighter2d/core/time/Time.h"
 #include "Mighter2d/core/time/Timer.h"
@@ -38,6 +38,7 @@
 #include "Mighter2d/graphics/SpriteSheet.h"
 #include "Mighter2d/graphics/Texture.h"
 #include "Mighter2d/graphics/Tile.h"
+#include "Mighter2d/graphics/TileMap.h"
 #include "Mighter2d/graphics/Drawable.h"
 #include "Mighter2d/graphics/Window.h"
 
@@ -0,0 +1,177 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_FLOWFIELD_H
+#define MIGHTER2D_FLOWFIELD_H
+
+#include "Mighter2d/Config.h"
+#include "Mighter2d/core/grid/Index.h"
+#include <vector>
+
+namespace mighter2d {
+    class Grid;
+
+    /**
+     * @brief The next step towards a destination from every tile of a Grid
+     *
+     * A flow field (also known as a Dijkstra map) is found by a single
+     * search outwards from the destination. It stores, for every tile,
+     * the cheapest cost of reaching the destination and the neighbouring
+     * tile to move to next. Any number of game objects heading for the
+     * same destination can then look up their next step in constant time
+     * instead of each finding their own path.
+     *
+     * Like the path finders, the flow field only moves horizontally and
+     * vertically and only through tiles that are not collidable and do
+     * not contain an active obstacle. The cost of entering a tile is
+     * the movement cost of the tile (see Grid::setMovementCostById),
+     * which is 1 for every tile by default.
+     *
+     * When the grid changes, update() only recomputes the tiles whose
+     * cost is affected by the tiles that changed (see Grid::getChangedTiles).
+     *
+     * A flow field is usually obtained from Grid::getFlowField, which
+     * shares one flow field between all the users of a destination and
+     * keeps it up to date
+     */
+    class MIGHTER2D_API FlowField {
+    public:
+        /**
+         * @brief Create a flow field
+         * @param grid The grid to create the flow field for
+         * @param destination The tile the flow field leads to
+         *
+         * @warning The flow field must not outlive @a grid
+         */
+        FlowField(const Grid& grid, const Index& destination);
+
+        /**
+         * @brief Get the tile the flow field leads to
+         * @return The destination of the flow field
+         */
+        const Index& getDestination() const;
+
+        /**
+         * @brief Bring the flow field up to date with its grid
+         *
+         * Nothing is done if the grid did not change since the last
+         * update. Otherwise only the tiles whose cost is affected by
+         * the changes are recomputed, unless the changes are not known
+         * per tile (e.g. a change of movement cost), in which case the
+         * flow field is recomputed entirely
+         */
+        void update();
+
+        /**
+         * @brief Get the tile to move to next from a tile
+         * @param index The index of the tile to move from
+         * @return The index of the neighbouring tile to move to, or
+         *         {-1, -1} if @a index is invalid, is the destination or
+         *         the destination cannot be reached from it
+         *
+         * A tile that cannot be entered, such as the tile of an obstacle
+         * following the flow field, still leads to its cheapest
+         * neighbour
+         */
+        Index getNextTile(const Index& index) const;
+
+        /**
+         * @brief Get the cost of reaching the destination from a tile
+         * @param index The index of the tile
+         * @return The cost of reaching the destination, or -1 if @a index
+         *         is invalid or the destination cannot be reached from it
+         */
+        float getCost(const Index& index) const;
+
+        /**
+         * @brief Check if the destination can be reached from a tile
+         * @param index The index of the tile
+         * @return True if the destination can be reached, otherwise false
+         */
+        bool isReachable(const Index& index) const;
+
+    private:
+        /**
+         * @brief A tile in the open set
+         */
+        struct OpenNode {
+            float cost;       //!< The cost of reaching the destination from the tile when the node was added
+            std::size_t tile; //!< Row-major position of the tile
+        };
+
+        /**
+         * @brief Recompute the flow field for all the tiles
+         */
+        void rebuild();
+
+        /**
+         * @brief Recompute the tiles affected by the tiles that changed
+         * @param changedTiles The tiles that changed
+         */
+        void repair(const std::vector<Index>& changedTiles);
+
+        /**
+         * @brief Find the cheapest way to the destination through the neighbours of a tile
+         * @param tile The row-major position of the tile
+         * @param next Set to the neighbour to move to next
+         * @return The cost of reaching the destination through @a next
+         */
+        float findCheapestNeighbour(std::size_t tile, std::size_t& next) const;
+
+        /**
+         * @brief Spread the costs of the tiles in the open set to their neighbours
+         */
+        void propagate();
+
+        /**
+         * @brief Check if a tile can be entered
+         * @param tile The row-major position of the tile
+         * @return True if the tile can be entered
+         */
+        bool isAccessible(std::size_t tile) const;
+
+        /**
+         * @brief Get the position of a tile in row-major order
+         * @param index The index of the tile
+         * @return The position of the tile or the number of tiles if @a index is invalid
+         */
+        std::size_t getTile(const Index& index) const;
+
+    private:
+        const Grid& grid_;                      //!< The grid the flow field is for
+        Index destination_;                     //!< The tile the flow field leads to
+        int rows_;                              //!< The number of rows in the grid the flow field was built for
+        int colms_;                             //!< The number of columns in the grid the flow field was built for
+        Uint64 version_;                        //!< The version of the grid the flow field was built from
+        bool isBuilt_;                          //!< Whether or not the flow field has been built
+        std::vector<float> costs_;              //!< The cost of reaching the destination from each tile that can be entered
+        std::vector<std::size_t> nextTiles_;    //!< The tile to move to next from each tile (the number of tiles if none)
+        std::vector<float> moveCosts_;          //!< The cost of entering each tile
+        std::vector<unsigned char> accessible_; //!< Whether or not each tile can be entered
+        std::vector<OpenNode> openSet_;         //!< Binary heap of the tiles whose cost must be spread to their neighbours
+        std::vector<Index> changedTiles_;       //!< The tiles that changed since the last update
+    };
+}
+
+#endif // MIGHTER2D_FLOWFIELD_H
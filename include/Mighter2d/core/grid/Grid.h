@@ -37,19 +37,35 @@
 #include <unordered_map>
 #include <vector>
 #include <unordered_set>
+#include <array>
+#include <memory>
 
 namespace mighter2d {
     using Map = std::vector<std::vector<char>>; //!< Alias for 2D vector of chars
 
     class GridObject;
+    class FlowField;
 
     /// @internal
     namespace priv {
+        class ConnectedComponents;
+        class GridChunkRenderer;
         class RenderTarget;
+        class TileStorage;
     }
 
     /**
      * @brief A 2D visual grid
+     *
+     * The tile data (id, collision flag and user bits) is stored in compact
+     * contiguous chunks of tiles. Tile objects are only created when they are
+     * first requested, for example through getTile(), so the cost of a grid
+     * stays proportional to the number of tiles actually accessed as Tile
+     * objects
+     *
+     * A grid that is too large to be kept in memory can be streamed from
+     * a file with streamFromFile(). Only the chunks around the focus points
+     * of the grid are then kept in memory (see setFocusPoints())
      */
     class MIGHTER2D_API Grid : public Drawable {
     public:
@@ -106,7 +122,11 @@ namespace mighter2d {
          * @param x X coordinate of the grid
          * @param y Y coordinate of the grid
          *
-         * The position is (0, 0) by default
+         * The position is (0, 0) by default. The positions of the tiles
+         * are derived from the position of the grid, so moving the grid
+         * takes constant time regardless of its number of tiles. A single
+         * "position" property change is emitted by the grid, the tiles do
+         * not emit position change events
          */
         void setPosition(int x, int y);
 
@@ -143,7 +163,14 @@ namespace mighter2d {
          * @throws InvalidParseException If the contents of @a filename cannot
          *         be successfully parsed into Grid map data
          *
-         * @see loadFromVector
+         * The file is either a text file, in which each line is a row of
+         * tile ids, or a binary map file created with convertToBinary().
+         * A binary map file is not parsed. It is mapped into memory and
+         * the tiles are read the first time they are accessed, so loading
+         * it takes constant time. The file must not be modified while the
+         * grid uses it
+         *
+         * @see loadFromVector and convertToBinary
          */
         void loadFromFile(const std::string& filename, const char& separator = '\0');
 
@@ -155,6 +182,130 @@ namespace mighter2d {
          */
         void loadFromVector(Map map);
 
+        /**
+         * @brief Stream the grid from a file on the disk
+         * @param filename Name of the file that contains the map data
+         * @param separator Character used to separate map data
+         * @throws FileNotFoundException If @a filename cannot be opened for reading
+         * @throws InvalidParseException If the contents of @a filename cannot
+         *         be streamed
+         *
+         * Unlike loadFromFile(), the file is mapped into memory and the tiles
+         * are only read when their chunk is needed. Chunks are loaded around
+         * the focus points of the grid and evicted once they are far from
+         * every focus point. A chunk is also loaded when a tile in it is
+         * accessed through the Index based functions, such as getTileId() or
+         * isCollidable(). Chunks in which a tile was modified individually,
+         * for example with setCollidableByIndex(), are never evicted
+         *
+         * The file is either a binary map file or a text file with the format
+         * accepted by loadFromFile(), except that all the rows must have the
+         * same number of tiles and, when a @a separator is used, exactly one
+         * separator between tiles. Prefer binary map files, which do not
+         * need a pass over the file to find the rows
+         *
+         * The file must not be modified while the grid streams it
+         *
+         * @note Functions that visit every tile, such as forEachTile(), load
+         * every chunk of a streamed grid. The chunks are evicted again the
+         * next time the focus points are updated. The features that need the
+         * whole grid at once behave as follows on a streamed grid:
+         * - isReachable() does not label the grid, it only rules out invalid
+         *   indexes and targets that cannot be entered
+         * - mighter2d::BFS and mighter2d::DFS find the neighbours of a tile
+         *   when they reach it, so only the chunks they visit are loaded
+         * - Flow fields (see getFlowField()) and mighter2d::PathService are
+         *   not supported
+         *
+         * @see setFocusPoints
+         */
+        void streamFromFile(const std::string& filename, const char& separator = '\0');
+
+        /**
+         * @brief Convert a text map file into a binary map file
+         * @param filename Name of the text map file
+         * @param binaryFilename Name of the binary map file to be created
+         * @param separator Character used to separate map data in the text file
+         * @throws FileNotFoundException If @a filename cannot be opened for
+         *         reading or @a binaryFilename cannot be opened for writing
+         * @throws InvalidParseException If the contents of @a filename cannot
+         *         be successfully parsed into Grid map data
+         *
+         * A binary map file stores the dimensions of the map followed by
+         * the raw tile ids. It loads much faster than a text map file and
+         * can be passed to loadFromFile() and streamFromFile()
+         */
+        static void convertToBinary(const std::string& filename, const std::string& binaryFilename,
+            const char& separator = '\0');
+
+        /**
+         * @brief Check if the grid is streamed from a file or not
+         * @return True if the grid is streamed, otherwise false
+         *
+         * @see streamFromFile
+         */
+        bool isStreamed() const;
+
+        /**
+         * @brief Set the points around which the chunks of a streamed grid are kept in memory
+         * @param points The focus points, in pixels
+         *
+         * Typical focus points are the centre of the camera and the position of
+         * agents that query the grid. The focus points may lie outside the grid.
+         * Call this function whenever the focus points move. The chunks around
+         * the new focus points are loaded and the chunks that are far from every
+         * focus point are evicted
+         *
+         * By default, a grid has no focus points. This function has no effect
+         * on the memory use of a grid that is not streamed
+         *
+         * @see setStreamingRadius
+         */
+        void setFocusPoints(const std::vector<Vector2f>& points);
+
+        /**
+         * @brief Get the points around which the chunks of a streamed grid are kept in memory
+         * @return The focus points, in pixels
+         *
+         * @see setFocusPoints
+         */
+        const std::vector<Vector2f>& getFocusPoints() const;
+
+        /**
+         * @brief Set the number of chunks loaded around each focus point
+         * @param radius The number of chunks loaded in every direction
+         *
+         * A chunk is evicted once it is more than @a radius + 1 chunks away
+         * from every focus point. A chunk is 32x32 tiles
+         *
+         * The radius only bounds the memory used between two updates of the
+         * focus points. Accessing a tile outside the radius, for example with
+         * a path finder whose search leaves it, loads its chunk until the
+         * next update (see streamFromFile() for the features that are
+         * limited on a streamed grid)
+         *
+         * By default, the radius is 1
+         *
+         * @see setFocusPoints
+         */
+        void setStreamingRadius(unsigned int radius);
+
+        /**
+         * @brief Get the number of chunks loaded around each focus point
+         * @return The number of chunks loaded in every direction
+         *
+         * @see setStreamingRadius
+         */
+        unsigned int getStreamingRadius() const;
+
+        /**
+         * @brief Get the number of chunks of tiles in memory
+         * @return The number of chunks in memory
+         *
+         * All the chunks of a grid that is not streamed are in memory
+         */
+        std::size_t getLoadedChunkCount() const;
+
         /**
          * @brief Enable or disable collision for a tile at a certain location
          * @param index Location (in tiles) of the tile
@@ -269,6 +420,197 @@ namespace mighter2d {
          */
         bool isCollidable(const Index& index) const;
 
+        /**
+         * @brief Check if a tile can be entered
+         * @param index Index of the tile to be checked
+         * @return True if the tile is not collidable and is not occupied by
+         *         an active obstacle, or false if it is or the index is invalid
+         *
+         * This is the test the path finders use to decide whether or not a
+         * path may pass through a tile
+         *
+         * @see isCollidable and GridObject::setObstacle
+         */
+        bool isTileAccessible(const Index& index) const;
+
+        /**
+         * @brief Check if a tile can be entered
+         * @param tile The tile to be checked
+         * @return True if the tile is not collidable and is not occupied by
+         *         an active obstacle, otherwise false
+         */
+        bool isTileAccessible(const Tile& tile) const;
+
+        /**
+         * @brief Get the id of a tile
+         * @param index Index of the tile
+         * @return The id of the tile or '\0' if the index is invalid
+         *
+         * Unlike getTile(index).getId(), this function does not create
+         * the Tile object of the tile
+         */
+        char getTileId(const Index& index) const;
+
+        /**
+         * @brief Set the user bits of a tile
+         * @param index Index of the tile
+         * @param bits The bits to be stored
+         *
+         * The user bits are not used by the grid, they are provided for
+         * attaching custom data (for example terrain flags) to tiles.
+         * This function has no effect if @a index is invalid
+         *
+         * By default, the user bits of a tile are 0
+         *
+         * @see getTileUserBits
+         */
+        void setTileUserBits(const Index& index, Uint32 bits);
+
+        /**
+         * @brief Get the user bits of a tile
+         * @param index Index of the tile
+         * @return The user bits of the tile or 0 if the index is invalid
+         *
+         * @see setTileUserBits
+         */
+        Uint32 getTileUserBits(const Index& index) const;
+
+        /**
+         * @brief Set the cost of moving into the tiles with a certain id
+         * @param id Identification of the tiles
+         * @param cost The cost of moving into one of the tiles
+         *
+         * Path finders that support weighted tiles (mighter2d::AStar)
+         * prefer paths with a lower total cost. A cost below 1 makes
+         * the distance estimate of such a path finder too high, which
+         * may produce paths that are not the cheapest
+         *
+         * By default, the cost of all tiles is 1
+         *
+         * @see getMovementCost
+         */
+        void setMovementCostById(char id, float cost);
+
+        /**
+         * @brief Get the cost of moving into the tiles with a certain id
+         * @param id Identification of the tiles
+         * @return The cost of moving into one of the tiles
+         *
+         * @see setMovementCostById
+         */
+        float getMovementCostById(char id) const;
+
+        /**
+         * @brief Get the cost of moving into a tile
+         * @param index Index of the tile
+         * @return The cost of moving into the tile or 1 if the index is
+         *         invalid
+         *
+         * @see setMovementCostById
+         */
+        float getMovementCost(const Index& index) const;
+
+        /**
+         * @brief Get the version of the grid
+         * @return The version of the grid
+         *
+         * The version is incremented by every change that may affect the
+         * paths through the grid: a tile becoming collidable or not
+         * collidable, an obstacle entering or leaving a tile or changing
+         * its obstacle or active state, a change of movement cost and a
+         * change of the tiled map. Path finders compare the version with
+         * the version their cached data was built from to detect that it
+         * is out of date
+         *
+         * @see getChangedTiles
+         */
+        Uint64 getVersion() const;
+
+        /**
+         * @brief Get the tiles that changed after a version
+         * @param version The version to get the changes since
+         * @param changedTiles Filled with the index of the tile of each change
+         *                     in the order of the changes (a tile may appear
+         *                     more than once)
+         * @return True if the changes are known, or false if the changes
+         *         since @a version are not recorded, in which case any data
+         *         built from the grid must be rebuilt entirely
+         *
+         * Changes that affect the whole grid, such as making all the tiles
+         * with a certain id collidable, are not recorded per tile
+         *
+         * @see getVersion
+         */
+        bool getChangedTiles(Uint64 version, std::vector<Index>& changedTiles) const;
+
+        /**
+         * @brief Check whether or not a tile can be reached from another tile
+         * @param sourceTile The index of the tile to start from
+         * @param targetTile The index of the tile to be reached
+         * @return True if there is a path from @a sourceTile to @a targetTile,
+         *         otherwise false
+         *
+         * A tile can be entered if it is not collidable and does not contain
+         * an active obstacle. The source tile itself need not be enterable,
+         * since it is usually occupied by the game object looking for a path.
+         *
+         * The grid labels the groups of tiles that are connected to each
+         * other, so the check is a comparison of two labels rather than a
+         * search. The labels are updated on the next check after the grid
+         * changes (see getVersion), only around the tiles that changed.
+         * Path finders use this function to reject unreachable targets
+         * before they start searching
+         *
+         * Labelling would load every chunk of a streamed grid (see
+         * streamFromFile), so on a streamed grid this function only checks
+         * that both indexes are valid and the target can be entered
+         */
+        bool isReachable(const Index& sourceTile, const Index& targetTile) const;
+
+        /**
+         * @brief Get the flow field leading to a tile
+         * @param destination The index of the tile the flow field leads to
+         * @return The flow field leading to @a destination
+         *
+         * The flow field is created the first time it is requested and
+         * is shared by all the users of the same destination. Every call
+         * brings the flow field up to date with the grid, recomputing only
+         * the tiles affected by the changes since the previous call, so
+         * game objects heading for the same tile can look up their next
+         * step in constant time instead of each finding their own path:
+         *
+         * @code
+         * mighter2d::Index next = grid.getFlowField(base).getNextTile(enemyIndex);
+         * @endcode
+         *
+         * The returned reference remains valid until the flow field is
+         * removed or the grid is destroyed
+         *
+         * @warning A flow field covers the whole grid, so this function
+         * must not be called on a streamed grid (see streamFromFile)
+         *
+         * @see removeFlowField
+         */
+        FlowField& getFlowField(const Index& destination);
+
+        /**
+         * @brief Remove the flow field leading to a tile
+         * @param destination The index of the tile the flow field leads to
+         *
+         * This function has no effect if there is no flow field for
+         * @a destination
+         *
+         * @see getFlowField, removeAllFlowFields
+         */
+        void removeFlowField(const Index& destination);
+
+        /**
+         * @brief Remove all the flow fields
+         *
+         * @see getFlowField, removeFlowField
+         */
+        void removeAllFlowFields();
+
         /**
          * @brief Get the size of the grid, in pixels
          * @return Size of the grid in pixels
@@ -308,6 +650,9 @@ namespace mighter2d {
          *         specified index is out of bounds of the grid
          *
          * A tile is invalid if it has a negative index
+         *
+         * The Tile object is created the first time it is requested. The
+         * returned reference remains valid until the grid is reconstructed
          */
         const Tile& getTile(const Index& index) const;
 
@@ -380,6 +725,11 @@ namespace mighter2d {
         /**
          * @brief Execute a callback on all the tiles of the grid
          * @param callback Function to execute for each tile
+         *
+         * This function does not create the Tile objects of the tiles that
+         * have not been requested yet. Such tiles are passed to the @a callback
+         * as a temporary tile which is only valid for the duration of the
+         * call. Use getTile() to obtain a reference that can be kept
          */
         void forEachTile(const Callback<const Tile&>& callback) const;
 
@@ -390,6 +740,8 @@ namespace mighter2d {
          * @param callback Function to execute for each tile
          *
          * @note Only horizontal ranges are supported
+         *
+         * @see forEachTile
          */
         void forEachTileInRange(Index startPos, Index endPos,
             const Callback<const Tile&>& callback) const;
@@ -401,9 +753,10 @@ namespace mighter2d {
          * @brief Render grid on a render target
          * @param renderTarget Target to render grid on
          *
-         * The grid's tiles do not belong to any render layer and are
-         * always drawn behind everything. That is, they are drawn first
-         * before the first render layer (layer at index 0) is drawn.
+         * The tiles are drawn in batches of one chunk at a time and
+         * only the chunks that intersect the view of the render target
+         * are drawn. A batch is only rebuilt after the colour or the
+         * collidable state of one of its tiles changes
          *
          * @warning This function is intended for internal use only and
          * should never be called outside of Mighter2d
@@ -538,6 +891,17 @@ namespace mighter2d {
          */
         void forEachChildInTile(const Tile& tile, const Callback<GridObject*>& callback) const;
 
+        /**
+         * @brief Execute a callback for each child in a tile
+         * @param index Index of the tile to execute callback on
+         * @param callback Function to execute
+         *
+         * The callback may add children to the tile or remove them from
+         * it. A child that is removed before it is reached is not visited
+         * and a child that is added during the iteration may not be visited
+         */
+        void forEachChildInTile(const Index& index, const Callback<GridObject*>& callback) const;
+
         /**
          * @internal
          * @brief Update grid
@@ -555,9 +919,29 @@ namespace mighter2d {
 
     private:
         /**
-         * @brief Create the visual gird
+         * @brief Create the tile data of the grid
+         * @param map Map data used to identify different tiles
          */
-        void createTiledMap();
+        void createTiledMap(const Map& map);
+
+        /**
+         * @brief Create the tile data of the grid
+         * @param rows The number of rows
+         * @param colms The number of columns
+         * @param id The id of each tile
+         */
+        void createTiledMap(unsigned int rows, unsigned int colms, char id);
+
+        /**
+         * @brief Reset the grid after its tile data changed
+         */
+        void resetTiledMap();
+
+        /**
+         * @brief Get the index of the tiles at the focus points
+         * @return The index of the tiles, which may be out of bounds
+         */
+        std::vector<Index> getFocusIndexes() const;
 
         /**
          * @brief Calculate size related attributes
@@ -566,6 +950,60 @@ namespace mighter2d {
          */
         void computeDimensions();
 
+        /**
+         * @brief Get the position of a tile in row-major order
+         * @param index The index of the tile
+         * @return The position of the tile in row-major order
+         *
+         * @warning @a index must be valid
+         */
+        std::size_t getDataIndex(const Index& index) const;
+
+        /**
+         * @brief Get the index of a tile from its position in row-major order
+         * @param dataIndex The position of the tile in row-major order
+         * @return The index of the tile
+         */
+        Index getIndex(std::size_t dataIndex) const;
+
+        /**
+         * @brief Get the index of the tile at a certain position
+         * @param position The position to be checked
+         * @return The index of the tile or {-1, -1} if @a position does
+         *         not lie within a tile
+         */
+        Index getIndexAt(const Vector2f& position) const;
+
+        /**
+         * @brief Get the position of a tile
+         * @param index The index of the tile
+         * @return The position of the tile
+         */
+        Vector2f getTilePosition(const Index& index) const;
+
+        /**
+         * @brief Get the position of a tile relative to the grid
+         * @param index The index of the tile
+         * @return The position of the tile relative to the position of the grid
+         */
+        Vector2f getTileOffset(const Index& index) const;
+
+        /**
+         * @brief Create a tile object that is drawn by the grid
+         * @return The created tile
+         *
+         * The tile is removed from its render layer because the grid
+         * draws all of its tiles
+         */
+        std::unique_ptr<Tile> createTile() const;
+
+        /**
+         * @brief Copy the data of a tile into a Tile object
+         * @param index The index of the tile
+         * @param tile The Tile object to be updated
+         */
+        void loadTile(const Index& index, Tile& tile) const;
+
         /**
          * @brief Get the tile above a tile at a given location
          * @param index Index of the tile to get the tile above
@@ -608,7 +1046,7 @@ namespace mighter2d {
 
         /**
          * @brief Set whether or not a tile is collidable
-         * @param tile The tile to enable or disable collisions for
+         * @param index The index of the tile
          * @param collidable True to set collidable, otherwise false
          * @param attachCollider True to attach a Collider to the tile, otherwise
          *                       false
@@ -621,13 +1059,32 @@ namespace mighter2d {
          *
          * By default, a tile is not collidable
          */
-        void setCollidable(Tile& tile, bool collidable, bool attacheCollider = false);
+        void setCollidable(const Index& index, bool collidable, bool attacheCollider = false);
 
         /**
-         * @brief Execute a callback on all the tiles of the grid
+         * @brief Update a Tile object after its collision flag changed
+         * @param tile The tile to be updated
+         * @param collidable True if the tile is collidable, otherwise false
+         */
+        void setCollidable(Tile& tile, bool collidable) const;
+
+        /**
+         * @brief Execute a callback on the Tile objects that have been created
          * @param callback Function to execute for each tile
          */
-        void forEachTile_(const Callback<Tile&>& callback);
+        void forEachCreatedTile(const Callback<Tile&>& callback);
+
+        /**
+         * @brief Execute a callback on consecutive tiles of a row
+         * @param startPos The index of the first tile
+         * @param count The number of tiles
+         * @param callback Function to execute for each tile
+         * @param tempTile Tile used to visit the tiles that have not been created
+         *
+         * @see forEachTile
+         */
+        void forEachTileInRow(const Index& startPos, unsigned int count, const Callback<const Tile&>& callback,
+            std::unique_ptr<Tile>& tempTile) const;
 
         /**
          * @brief Update the grid when a render property changes
@@ -641,6 +1098,42 @@ namespace mighter2d {
          */
         void unsubscribeDestructionListener(GridObject* child);
 
+        /**
+         * @brief Remove the property change listener from a game object
+         * @param child The game object to remove the property change listener from
+         */
+        void unsubscribePropertyChangeListener(GridObject* child);
+
+        /**
+         * @brief Record a change that may affect the paths through a tile
+         * @param index The index of the tile
+         */
+        void markChanged(const Index& index);
+
+        /**
+         * @brief Record a change that may affect the paths through any tile
+         */
+        void markAllChanged();
+
+        /**
+         * @brief Move a child to the occupancy bucket of the tile it is in
+         * @param child The child to be updated
+         *
+         * A child that is not in any tile is not in any occupancy bucket
+         */
+        void updateOccupiedTile(GridObject* child);
+
+        /**
+         * @brief Update the occupancy buckets of all the children
+         */
+        void updateOccupiedTiles();
+
+        /**
+         * @brief Remove a child from the occupancy bucket it is in
+         * @param child The child to be removed
+         */
+        void removeFromOccupiedTile(GridObject* child);
+
     private:
         Scene& scene_;                       //!< The scene the grid belongs to
         unsigned int tileSpacing_;           //!< Spacing between tiles in all directions
@@ -649,14 +1142,26 @@ namespace mighter2d {
         Vector2f mapPos_;                    //!< The Position of the grid in pixels
         unsigned int numOfRows_;             //!< The width of the grid in tiles
         unsigned int numOfColms_;            //!< The height of the grid in tiles
-        Map mapData_;                        //!< Map data used to identify different tiles
         Tile invalidTile_;                   //!< Tile returned when an invalid index is provided
         GridRenderer renderer_;           //!< Determines the look of the grid
         RectangleShape backgroundTile_;      //!< Dictates the background colour of the grid
 
         std::unordered_set<GridObject*> children_; //!< Stores the id's of game objects that belong to the grid
         std::unordered_map<unsigned int, int> destructionIds_;         //!< Holds the id of the destruction listeners (key = object id, value = destruction id)
-        std::vector<std::vector<Tile>> tiledMap_;                      //!< Tiles container
+        std::unordered_map<unsigned int, int> propertyChangeIds_;      //!< Holds the id of the property change listeners (key = object id, value = listener id)
+        std::unordered_map<const GridObject*, std::size_t> occupiedTiles_;             //!< The tile occupied by each child (value = row-major position of the tile)
+        std::unordered_map<std::size_t, std::vector<GridObject*>> tileOccupants_;     //!< The children in each occupied tile (key = row-major position of the tile)
+        std::unique_ptr<priv::TileStorage> tileStorage_;               //!< Stores the id, collision flag and user bits of the tiles
+        mutable std::unordered_map<std::size_t, std::unique_ptr<Tile>> tiles_; //!< Tile objects created on demand (key = row-major position)
+        std::unique_ptr<priv::GridChunkRenderer> chunkRenderer_;       //!< Draws the tiles in batches
+        std::vector<Vector2f> focusPoints_;                            //!< The points around which the chunks of a streamed grid are kept in memory
+        unsigned int streamingRadius_;                                 //!< The number of chunks loaded around each focus point
+        std::array<float, 256> movementCosts_;                         //!< The cost of moving into a tile (index = tile id as an unsigned char)
+        Uint64 version_;                                               //!< Incremented by every change that may affect paths through the grid
+        Uint64 changeLogVersion_;                                      //!< The version from which changedTiles_ records the changes
+        std::vector<Index> changedTiles_;                              //!< The tile of each change after changeLogVersion_ (one entry per version)
+        std::unordered_map<Index, std::unique_ptr<FlowField>> flowFields_; //!< The flow fields shared by the users of a destination (key = destination)
+        std::unique_ptr<priv::ConnectedComponents> components_;       //!< Labels the groups of tiles that are reachable from each other
 
         friend class Scene;
     };
@@ -28,8 +28,16 @@
 #include "Mighter2d/Config.h"
 #include <string>
 #include <unordered_set>
+#include <cstdint>
 
 namespace mighter2d {
+    class Collidable;
+
+    /// @internal
+    namespace priv {
+        class CollisionGroupRegistry;
+    }
+
     /**
      * @brief A GameObject collision exclusion list
      *
@@ -38,6 +46,28 @@ namespace mighter2d {
      */
     class MIGHTER2D_API CollisionExcludeList {
     public:
+        /**
+         * @brief Default constructor
+         */
+        CollisionExcludeList();
+
+        /**
+         * @brief Copy constructor
+         * @param other The list to be copied
+         *
+         * The copy does not belong to the owner of @a other
+         */
+        CollisionExcludeList(const CollisionExcludeList& other);
+
+        /**
+         * @brief Copy assignment operator
+         * @param other The list to be copied
+         * @return A reference to this list
+         *
+         * The list keeps its current owner and notifies it of the change
+         */
+        CollisionExcludeList& operator=(const CollisionExcludeList& other);
+
         /**
          * @brief Add a group to the list
          * @param group The name of the group to be added
@@ -57,7 +87,7 @@ namespace mighter2d {
          * @param group The name of the group to be checked
          * @return True if the group exits in the list, otherwise false
          */
-        bool contains(const std::string& group);
+        bool contains(const std::string& group) const;
 
         /**
          * @brief Get the number of groups in the list
@@ -70,8 +100,68 @@ namespace mighter2d {
          */
         void clear();
 
+    public:
+        ////////////////////////////////////////////////////////////
+        //  Internal functions
+        ////////////////////////////////////////////////////////////
+
+        /**
+         * @internal
+         * @brief Set the registry used to map the groups in the list to bits
+         * @param registry The registry to be used or a nullptr to stop mapping groups
+         *
+         * @warning This function is intended for internal use only
+         */
+        void setGroupRegistry(priv::CollisionGroupRegistry* registry);
+
+        /**
+         * @internal
+         * @brief Set the collidable that owns the list
+         * @param owner The collidable to be notified when the list changes
+         *
+         * @warning This function is intended for internal use only
+         */
+        void setOwner(Collidable* owner);
+
+        /**
+         * @internal
+         * @brief Get the bitwise OR of the bits of all the groups in the list
+         * @return The bitmask of the list
+         *
+         * @warning This function is intended for internal use only
+         */
+        std::uint64_t getMask() const {
+            return mask_;
+        }
+
+        /**
+         * @internal
+         * @brief Check if every group in the list is represented in the mask
+         * @return True if the mask can be used instead of contains(), otherwise false
+         *
+         * @warning This function is intended for internal use only
+         */
+        bool isMaskComplete() const {
+            return isMaskComplete_;
+        }
+
+    private:
+        /**
+         * @brief Helper function for recomputing the mask of the list
+         */
+        void updateMask();
+
+        /**
+         * @brief Notify the owner of the list that the list changed
+         */
+        void notifyOwner();
+
     private:
-        std::unordered_set<std::string> list_; //!< List container
+        std::unordered_set<std::string> list_;      //!< List container
+        priv::CollisionGroupRegistry* registry_;    //!< Maps groups to bits
+        std::uint64_t mask_;                        //!< Bits of the groups in the list
+        bool isMaskComplete_;                       //!< A flag indicating whether or not all groups are in the mask
+        Collidable* owner_;                         //!< The collidable whose collision filter depends on the list
     };
 }
 
@@ -31,6 +31,7 @@
 #include "Mighter2d/common/PropertyContainer.h"
 #include "Mighter2d/common/IUpdatable.h"
 #include "Mighter2d/core/object/Object.h"
+#include "Mighter2d/core/physics/BoundingBox.h"
 #include "Mighter2d/graphics/Sprite.h"
 #include <memory>
 
@@ -196,6 +197,19 @@ namespace mighter2d {
         Sprite& getSprite();
         const Sprite& getSprite() const;
 
+        /**
+         * @brief Get the bounding box of the game object
+         * @return The bounding box of the game object
+         *
+         * The bounding box is located at the position of the game object
+         * and has the size of the global bounds of its sprite. It is cached
+         * and only recomputed when the position, origin, scale, rotation,
+         * texture or texture rectangle of the game object or its sprite
+         * changes. A "boundingBox" property change event is emitted every
+         * time it is recomputed
+         */
+        const BoundingBox& getBoundingBox() const;
+
         /**
          * @brief Destructor
          */
@@ -217,6 +231,11 @@ namespace mighter2d {
          */
         void resetSpriteOrigin();
 
+        /**
+         * @brief Recompute the cached bounding box and emit its change
+         */
+        void updateBoundingBox();
+
     private:
         std::reference_wrapper<Scene> scene_; //!< The scene this game object belongs to
         int state_;                           //!< The current state of the game object
@@ -224,6 +243,7 @@ namespace mighter2d {
         Transform transform_;                 //!< The objects transform
         std::unique_ptr<Sprite> sprite_;       //!< The objects visual representation
         PropertyContainer userData_;          //!< Used to store metadata about the object
+        BoundingBox boundingBox_;             //!< The cached bounding box of the object
     };
 }
 
@@ -103,6 +103,8 @@ namespace mighter2d {
         /**
          * @brief Get the objects bounding box
          * @return The objects bounding box
+         *
+         * @see GameObject::getBoundingBox
          */
         const BoundingBox &getBoundingBox() const override;
 
@@ -438,6 +440,12 @@ namespace mighter2d {
          */
         ~GridObject() override;
 
+    private:
+        /**
+         * @brief Keep the scene informed about bounding box changes
+         */
+        void initEvents();
+
     private:
         Grid* grid_;                         //!< The grid the object is in
         bool isObstacle_;                   //!< A flag indicating whether or not the object is an obstacle
@@ -445,6 +453,7 @@ namespace mighter2d {
         Vector2f speed_;                    //!< The speed of the game object
         CollisionExcludeList obstacleColFilter_;     //!< Stores the collision groups of game objects that can collide with an obstacle without being blocked
         GridMover* gridMover_;              //!< The objects grid mover
+        int propertyChangeListenerId_;      //!< Bounding box change listener id
     };
 }
 
@@ -29,11 +29,16 @@
 #include "Mighter2d/common/Vector2.h"
 #include "Mighter2d/core/physics/BoundingBox.h"
 #include "Mighter2d/core/object/CollisionExcludeList.h"
-#include <vector>
+#include <cstdint>
 
 namespace mighter2d {
     class Scene;
 
+    /// @internal
+    namespace priv {
+        class CollisionGroupRegistry;
+    }
+
     /**
      * @brief Base class for collidable entities
      *
@@ -59,6 +64,19 @@ namespace mighter2d {
          */
         explicit Collidable(Scene& scene);
 
+        /**
+         * @brief Copy constructor
+         * @param other The collidable to be copied
+         */
+        Collidable(const Collidable& other);
+
+        /**
+         * @brief Copy assignment operator
+         * @param other The collidable to be copied
+         * @return A reference to this collidable
+         */
+        Collidable& operator=(const Collidable& other) = default;
+
         /**
          * @brief Set whether or not this collidable can overlap with other collidables
          * @param enable True to enable overlap detection, otherwise false
@@ -116,6 +134,12 @@ namespace mighter2d {
          * will collide with any other collidables whose collision id is the same
          * as theirs.
          *
+         * Note that the scene maps each collision group name to a bit the
+         * first time it is used, so that group filtering does not compare
+         * strings. Only the first 64 distinct group names of a scene are
+         * mapped, collidables using any other group are filtered using
+         * (slower) string comparisons
+         *
          * @see getCollisionGroup, setCollisionId and getCollisionExcludeList
          */
         void setCollisionGroup(const std::string& colGroup);
@@ -185,6 +209,40 @@ namespace mighter2d {
          */
         bool isStatic() const;
 
+        /**
+         * @brief Enable or disable continuous collision detection
+         * @param enable True to enable continuous collision detection, otherwise false
+         *
+         * Overlaps are normally only detected at the position the collidable
+         * has at the end of a frame. A collidable that moves further than the
+         * size of another collidable in a single frame may therefore pass
+         * through it without an overlap being detected (tunnelling).
+         *
+         * When continuous collision detection is enabled, the motion of the
+         * collidable since the previous frame is swept and an overlap is
+         * detected with every collidable it passed through. The time within
+         * the frame at which the overlap started is passed to
+         * onSweptOverlapStart. An overlap that only
+         * happened during the motion ends at the next frame.
+         *
+         * Continuous collision detection is more expensive than the regular
+         * detection, it should only be enabled on small fast moving collidables
+         * such as bullets.
+         *
+         * By default, continuous collision detection is disabled
+         *
+         * @see isContinuousCollisionEnabled
+         */
+        void setContinuousCollisionEnable(bool enable);
+
+        /**
+         * @brief Check if continuous collision detection is enabled or not
+         * @return True if enabled, otherwise false
+         *
+         * @see setContinuousCollisionEnable
+         */
+        bool isContinuousCollisionEnabled() const;
+
         /**
          * @brief Get the collidables collision exclude list
          * @return The collidables collision exclude list
@@ -226,10 +284,39 @@ namespace mighter2d {
          * @note This function is called automatically once per frame when this collidable
          * and another collidable start to overlap.
          *
-         * @see onOverlapEnd
+         * @see onSweptOverlapStart and onOverlapEnd
          */
         virtual void onOverlapStart(Collidable& other, float IoU) { MIGHTER2D_UNUSED(other); MIGHTER2D_UNUSED(IoU);}
 
+        /**
+         * @brief Handle an overlap between this object and another
+         * @param other The collidable that's starting to overlap with this collidable
+         * @param IoU The percentage of overlap between the two collidables in the range [0, 1]
+         * @param timeOfImpact The time within the frame at which the overlap started in the range [0, 1]
+         *
+         * The time of impact is the fraction of the motion of the collidables
+         * since the previous frame at which their bounding boxes started to
+         * overlap, 0 being their position at the previous frame and 1 their
+         * current position. It is only computed when continuous collision
+         * detection is enabled on at least one of the two collidables (see
+         * setContinuousCollisionEnable), otherwise it is always 1.
+         *
+         * An overlap that only happened during the motion (the collidable
+         * passed through the other one) has an IoU of 0.
+         *
+         * By default, this function calls onOverlapStart. Override it
+         * instead of the latter to get the time of impact
+         *
+         * @note This function is called automatically once per frame when this collidable
+         * and another collidable start to overlap.
+         *
+         * @see onOverlapEnd
+         */
+        virtual void onSweptOverlapStart(Collidable& other, float IoU, float timeOfImpact) {
+            MIGHTER2D_UNUSED(timeOfImpact);
+            onOverlapStart(other, IoU);
+        }
+
         /**
          * @brief Handle an overlap stay
          * @param other The collidable that is remaining in contact with this collidable
@@ -276,43 +363,79 @@ namespace mighter2d {
 
         /**
          * @internal
-         * @brief Handler a collidable overlap
-         * @param other The collidable
+         * @brief Check if the collision filters allow a collision with another collidable
+         * @param other The collidable to be checked
+         * @return True if the two collidables can collide, otherwise false
          *
          * @warning This function is intended for internal use only
          */
-        void handleCollidable(Collidable& other);
+        bool canCollideWith(const Collidable& other) const;
 
-    private:
         /**
-         * @brief Add a collidable with this game object
-         * @param collidable The overlapper to be added
+         * @internal
+         * @brief Check if collision group filtering prevents a collision with another collidable
+         * @param other The collidable to be checked
+         * @return True if the collision group of either collidable is in the
+         *         collision exclude list of the other, otherwise false
+         *
+         * @warning This function is intended for internal use only
          */
-        void addCollidable(Collidable* collidable);
+        bool isCollisionGroupExcluded(const Collidable& other) const;
 
         /**
-         * @brief Check if this object has an overlapper
-         * @param collidable The overlapper to be checked
-         * @return True if it has it, otherwiae false
+         * @internal
+         * @brief Set the registry used to map collision groups to bits
+         * @param registry The registry of the scene the collidable belongs to
+         *
+         * @warning This function is intended for internal use only
          */
-        bool hasCollidable(Collidable* collidable);
+        void setCollisionGroupRegistry(priv::CollisionGroupRegistry* registry);
 
         /**
          * @internal
-         * @brief Remove an overlapper
-         * @param collidable The overlapper to be removed
+         * @brief Set the scene the collidable belongs to
+         * @param scene The scene the collidable was moved to
+         *
+         * The collidable must already be registered with @a scene and its
+         * destruction listener must have been moved along with it
+         *
+         * @warning This function is intended for internal use only
+         */
+        void setScene(Scene& scene);
+
+    protected:
+        /**
+         * @brief Notify the scene that the bounding box of the collidable changed
+         *
+         * Derived classes must call this function whenever the bounding
+         * box returned by getBoundingBox() changes. Collidables that did
+         * not notify a change since the last frame are considered stationary:
+         * their overlaps are not tested again and the spatial queries of the
+         * scene (see mighter2d::Scene::queryAABB) find them at their last
+         * notified location
+         */
+        void notifyBoundingBoxChange();
+
+    private:
+        /**
+         * @brief Notify the scene that the collision filter of the collidable changed
+         *
+         * The overlaps of the collidable are tested again at the next frame
          */
-        void removeCollidable(Collidable* collidable);
+        void notifyCollisionFilterChange();
 
     private:
         Scene* scene_;                         //!< The scene the collidable belongs to
         int sceneDestrucListenerId_;           //!< The id of the scenes destruction listener
         std::string collisionGroup_;           //!< The collidables collision group (collision filtering)
+        std::uint64_t collisionGroupBit_;      //!< The bit of the collision group, 0 if the group has no bit
+        priv::CollisionGroupRegistry* groupRegistry_; //!< Maps collision groups to bits
         int collisionId_;                      //!< The collidables collision id (collision filtering)
         bool isStatic_;                        //!< A flag indicating whether or not the collidable is static (i.e immovable)
+        bool isContinuousColEnabled_;          //!< A flag indicating whether or not continuous collision detection is enabled
         bool isOverlapDetEnabled_;             //!< A flag indicating whether or not overlap detection is enabled
         CollisionExcludeList excludeList_;     //!< Stores the collision groups of collidables this collidable must not collide with
-        std::vector<Collidable*> collidables_; //!< Collidables currently overlapping with this collidable
+        friend class CollisionExcludeList;     //!< Notifies changes to the collision filter
     };
 }
 
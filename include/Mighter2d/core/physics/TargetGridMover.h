@@ -27,6 +27,8 @@
 
 #include "GridMover.h"
 #include "Mighter2d/core/physics/path/IPathFinderStrategy.h"
+#include "Mighter2d/core/physics/path/PathCache.h"
+#include "Mighter2d/core/physics/path/PathService.h"
 
 namespace mighter2d {
 
@@ -83,7 +85,16 @@ namespace mighter2d {
          * @brief Set the path finder
          * @param pathFinder New path finder
          *
-         * The default path finder is mighter2d::BFS
+         * The default path finder is mighter2d::BFS. On large open grids,
+         * mighter2d::AStar expands far fewer tiles per path. Use its
+         * Octile heuristic if the target may move diagonally. If all
+         * the tiles cost the same to enter, mighter2d::JPS expands fewer
+         * tiles still. On very large grids, mighter2d::HPAStar searches
+         * a precomputed graph of cluster entrances instead of the tiles
+         *
+         * @code
+         * mover.setPathFinder(std::make_unique<mighter2d::AStar>(grid.getSizeInTiles()));
+         * @endcode
          */
         void setPathFinder(std::unique_ptr<IPathFinderStrategy> pathFinder);
 
@@ -93,6 +104,63 @@ namespace mighter2d {
          */
         std::string getPathFinderType() const;
 
+        /**
+         * @brief Set the cache of the paths found by the path finder
+         * @param pathCache The path cache or a nullptr to disable caching
+         *
+         * When a path cache is set, the path finder is only used when the
+         * cache does not have a path from the targets current tile to its
+         * destination that is still valid in the grid (see PathCache). This
+         * makes repeated requests for the same path cheap. The same cache can be
+         * shared by all the targets in the grid:
+         *
+         * @code
+         * auto pathCache = std::make_shared<mighter2d::PathCache>();
+         * mover1.setPathCache(pathCache);
+         * mover2.setPathCache(pathCache);
+         * @endcode
+         *
+         * By default, there is no path cache
+         */
+        void setPathCache(std::shared_ptr<PathCache> pathCache);
+
+        /**
+         * @brief Get the cache of the paths found by the path finder
+         * @return The path cache or a nullptr if caching is disabled
+         *
+         * @see setPathCache
+         */
+        std::shared_ptr<PathCache> getPathCache() const;
+
+        /**
+         * @brief Set the path service that finds the targets paths
+         * @param pathService The path service or a nullptr to find the
+         *                    paths on the calling thread
+         *
+         * When a path service is set, the targets path is requested from
+         * it instead of being found by the path finder (see setPathFinder).
+         * The target then waits on its current tile until the path is
+         * delivered on a later frame, after which the path generation
+         * event is fired (see onPathGenFinish) and the target starts
+         * moving. A path service can be shared by many targets in the same
+         * grid. If it is destroyed, the target falls back to its path finder
+         *
+         * isDestinationReachable() does not use the path service, it
+         * answers immediately from the grid (see Grid::isReachable)
+         *
+         * By default, there is no path service
+         */
+        void setPathService(PathService* pathService);
+
+        /**
+         * @brief Get the path service that finds the targets paths
+         * @return The path service or a nullptr if the paths are found
+         *         on the calling thread
+         *
+         * @see setPathService
+         */
+        PathService* getPathService() const;
+
         /**
          * @brief Set the index of the tile the target should go to
          * @param index The targets new destination (in tiles)
@@ -158,10 +226,9 @@ namespace mighter2d {
          * @return True if the destination is reachable from the targets
          *         current position otherwise false
          *
-         * @warning This function is expensive when the grid has a lot of
-         * accessible tiles because the path is regenerated every time the
-         * function is called to accommodate changes in position since the
-         * destination was set
+         * This function does not find a path, it compares the labels of
+         * the connected tiles of the grid (see Grid::isReachable), so it
+         * is cheap enough to be called for many candidate destinations
          *
          * @see setDestination
          */
@@ -173,12 +240,7 @@ namespace mighter2d {
          * @return True if the destination is reachable from the targets
          *         current position otherwise false
          *
-         * @warning This function is expensive when the grid has a lot of
-         * accessible tiles because the path is regenerated every time the
-         * function is called to accommodate changes in position since the
-         * destination was set
-         *
-         * @see setDestination
+         * @see setDestination and isDestinationReachable(const Index&)
          */
         bool isDestinationReachable(const Vector2f& position) const;
 
@@ -231,6 +293,34 @@ namespace mighter2d {
          */
         bool isAdaptiveMoveEnabled() const;
 
+        /**
+         * @brief Enable or disable flow field movement
+         * @param enable True to enable, otherwise false
+         *
+         * When flow field movement is enabled, the target does not find its
+         * own path to its destination. Instead, after every move, it looks
+         * up its next step in the flow field of its destination (see
+         * Grid::getFlowField), which is shared by all the targets heading
+         * for the same tile. This is much cheaper than a path per target
+         * when many targets have the same destination, and like adaptive
+         * movement, the target always takes the current cheapest way to
+         * its destination. The path (see getPath()) then only contains the
+         * next tile and the path finder is not used.
+         *
+         * By default, flow field movement is disabled
+         *
+         * @see setPathFinder
+         */
+        void setFlowFieldEnable(bool enable);
+
+        /**
+         * @brief Check if flow field movement is enabled or not
+         * @return True if enabled, otherwise false
+         *
+         * @see setFlowFieldEnable
+         */
+        bool isFlowFieldEnabled() const;
+
         /**
          * @brief Add an event listener to a destination reached event
          * @param callback Function to execute when the target reaches its
@@ -269,7 +359,8 @@ namespace mighter2d {
          * The path generation event is triggered when the targets destination
          * is set. If the target is currently not moving, the event will be
          * triggered immediately. However, if the target is moving, the event
-         * will be triggered the next time the path is generated
+         * will be triggered the next time the path is generated. If a path
+         * service is set, the event is triggered when the path is delivered
          *
          * On invocation the callback is passed the generated path (which may
          * be empty - see setDestination()). Note that, only one event listener
@@ -308,6 +399,25 @@ namespace mighter2d {
          */
         void generatePath();
 
+        /**
+         * @brief Find a path using the path cache and the path finder
+         * @param sourceTile The tile the path starts from
+         * @param targetTile The tile the path leads to
+         * @return The path from the source to the target if reachable,
+         *         otherwise an empty path
+         */
+        std::stack<Index> findPath(const Index& sourceTile, const Index& targetTile) const;
+
+        /**
+         * @brief Request the path to the target from the path service
+         */
+        void requestPath();
+
+        /**
+         * @brief Cancel the path request waiting for the path service, if any
+         */
+        void cancelPathRequest();
+
         /**
          * @brief Move the target
          */
@@ -322,7 +432,12 @@ namespace mighter2d {
         bool movementStarted_;                            //!< Flags whether the target has been stopped or not
         bool targetTileChangedWhileMoving_;               //!< Flags whether the target tile was changed while target was in motion
         bool isAdaptiveMoveEnabled_;                      //!< A flag indicating whether or not adaptive movement is enabled
+        bool isFlowFieldEnabled_;                         //!< A flag indicating whether or not the next step is taken from the grid's flow field
         bool isPendingMove_;                              //!< A flag indicating whether or not adjacent move was rejected
+        std::shared_ptr<PathCache> pathCache_;            //!< Remembers the paths found by the path finder
+        PathService* pathService_;                        //!< Finds the path on a worker thread when set
+        int pathServiceDestructionId_;                    //!< The id of the path services destruction listener
+        int pathRequestId_;                               //!< The id of the path request waiting for the path service
         Callback<const std::stack<Index>&> onPathGen_;    //!< A function executed after path generation
     };
 }
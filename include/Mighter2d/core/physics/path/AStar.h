@@ -0,0 +1,135 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_ASTAR_H
+#define MIGHTER2D_ASTAR_H
+
+#include "IPathFinderStrategy.h"
+#include "Mighter2d/common/Vector2.h"
+#include <memory>
+
+namespace mighter2d {
+    /// @internal
+    namespace priv {
+        class AStarSearch;
+    }
+
+    /**
+     * @brief Finds a path in a Grid using the A* algorithm
+     *
+     * Unlike mighter2d::BFS, A* only expands the tiles that lead towards
+     * the target, and it finds the cheapest path when the tiles of the
+     * grid have different movement costs (see Grid::setMovementCostById).
+     *
+     * A tile can be entered if it is not collidable and does not contain
+     * an active obstacle. The heuristic determines the moves that are
+     * allowed: with the Manhattan heuristic the path only moves
+     * horizontally and vertically, and with the Octile heuristic it may
+     * also move diagonally. A diagonal move costs sqrt(2) times the cost
+     * of the tile and it is only allowed if both tiles beside it can be
+     * entered, so the path never cuts the corner of a blocked tile
+     */
+    class MIGHTER2D_API AStar : public IPathFinderStrategy {
+    public:
+        /**
+         * @brief The estimate of the remaining cost to the target
+         */
+        enum class Heuristic {
+            Manhattan, //!< Sum of the horizontal and vertical distances (W, N, E, S moves)
+            Octile     //!< Distance when diagonal moves are allowed (W, NW, N, NE, E, SE, S, SW moves)
+        };
+
+        /**
+         * @brief Initialize the algorithm
+         * @param gridSize Size of the grid in tiles
+         * @param heuristic The estimate of the remaining cost to the target
+         */
+        explicit AStar(const Vector2u& gridSize, Heuristic heuristic = Heuristic::Manhattan);
+
+        /**
+         * @brief Copy constructor
+         */
+        AStar(const AStar&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        AStar& operator=(const AStar&) = delete;
+
+        /**
+         * @brief Set the heuristic
+         * @param heuristic The estimate of the remaining cost to the target
+         *
+         * By default, the heuristic is Heuristic::Manhattan
+         */
+        void setHeuristic(Heuristic heuristic);
+
+        /**
+         * @brief Get the heuristic
+         * @return The estimate of the remaining cost to the target
+         */
+        Heuristic getHeuristic() const;
+
+        /**
+         * @brief Generate a path from a source tile to a target tile in a grid
+         * @param grid Grid to find path in
+         * @param sourceTile The position of the starting position in tiles
+         * @param targetTile The position of the destination in tiles
+         * @return The path from the source to the destination if reachable,
+         *         otherwise an empty path
+         */
+        std::stack<Index> findPath(const Grid& grid, const Index& sourceTile,
+                                   const Index& targetTile) override;
+
+        /**
+         * @brief Get the number of tiles expanded by the last search
+         * @return The number of tiles expanded by the last call to findPath
+         */
+        std::size_t getExpandedCount() const;
+
+        /**
+         * @brief Get the type of path finding algorithm
+         * @return The type of the path finding algorithm
+         */
+        std::string getType() const override;
+
+        /**
+         * @brief Get the settings that change the paths found by the algorithm
+         * @return The name of the heuristic
+         */
+        std::string getSettings() const override;
+
+        /**
+         * @brief Destructor
+         */
+        ~AStar() override;
+
+    private:
+        Heuristic heuristic_;                       //!< The estimate of the remaining cost to the target
+        std::unique_ptr<priv::AStarSearch> search_; //!< Finds the paths
+        std::size_t expandedCount_;                 //!< The number of tiles expanded by the last search
+    };
+}
+
+#endif // MIGHTER2D_ASTAR_H
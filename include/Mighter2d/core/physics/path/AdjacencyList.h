@@ -37,31 +37,109 @@ namespace mighter2d {
      *        in a grid
      *
      * An accessible node is one that does not contain an obstacle and it is
-     * not a solid tile
+     * not a solid tile.
+     *
+     * The neighbours are stored in a single array with a fixed number of
+     * slots per tile (a tile has at most 4 neighbours), so the neighbours
+     * of a tile are found in constant time and the list can be patched in
+     * place when some tiles of the grid change instead of being rebuilt
+     *
+     * Building the list would load every chunk of a streamed grid (see
+     * Grid::streamFromFile), so for a streamed grid no list is stored and
+     * the neighbours of a tile are found when they are requested instead
      */
     class MIGHTER2D_API AdjacencyList {
     public:
+        /**
+         * @brief A view of the neighbours of a tile
+         *
+         * The view is invalidated by the next call to generateFrom. When
+         * the list was generated from a streamed grid, it is also invalidated
+         * by the next call to getNeighbours
+         */
+        struct Neighbours {
+            const Index* first; //!< The first neighbour
+            const Index* last;  //!< One past the last neighbour
+
+            const Index* begin() const { return first; }
+            const Index* end() const { return last; }
+            std::size_t size() const { return static_cast<std::size_t>(last - first); }
+            bool empty() const { return first == last; }
+        };
+
+        /**
+         * @brief Constructor
+         */
+        AdjacencyList();
+
         /**
          * @brief Generate adjacency list from a grid
          * @param grid grid to generate adjacency list for
          *
          * This function will generate a list of neighbouring tiles for
          * each node/tile in the grid. This functions assumes that the
-         * grid nodes are bidirectional
+         * grid nodes are bidirectional.
+         *
+         * If the list was last generated from the same grid, only the
+         * tiles that changed since then (see Grid::getChangedTiles) are
+         * updated and nothing is done when the grid has not changed
          */
         void generateFrom(const Grid& grid);
 
         /**
          * @brief Get the neighbours of a node at a certain position in the grid
          * @param index Location of the tile to get the neighbours of
-         * @return The tiles neighbours or an empty vector if the index is
-         *         invalid
+         * @return The tiles neighbours or an empty range if the index is
+         *         invalid or the tile is not accessible
          */
-        const std::vector<Index>& getNeighbours(const Index& index) const;
+        Neighbours getNeighbours(const Index& index) const;
 
     private:
-        std::vector<std::pair<Index, std::vector<Index>>> adjacencyList_; //!< Adjacency list data
-        const std::vector<Index> emptyVec{};                              //!< Dummy vector
+        /**
+         * @brief Build the list for all the tiles of a grid
+         * @param grid The grid to build the list from
+         */
+        void rebuild(const Grid& grid);
+
+        /**
+         * @brief Update the list after a tile changed
+         * @param grid The grid the list is built from
+         * @param index The index of the tile that changed
+         */
+        void patch(const Grid& grid, const Index& index);
+
+        /**
+         * @brief Find the neighbours of a tile
+         * @param index The index of the tile
+         */
+        void updateNeighbours(const Index& index);
+
+        /**
+         * @brief Check if a tile is accessible
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return True if the tile is in the grid and is accessible
+         */
+        bool isAccessible(int row, int colm) const;
+
+        /**
+         * @brief Find the neighbours of a tile of a streamed grid
+         * @param index The index of the tile
+         * @return The neighbours of the tile
+         */
+        Neighbours findStreamedNeighbours(const Index& index) const;
+
+        static constexpr std::size_t MAX_NEIGHBOURS = 4; //!< The number of neighbour slots per tile
+        std::vector<Index> neighbours_;                  //!< The neighbours of each tile (MAX_NEIGHBOURS slots per tile)
+        std::vector<unsigned char> degrees_;             //!< The number of neighbours of each tile
+        std::vector<unsigned char> accessible_;          //!< Whether or not each tile is accessible
+        std::vector<Index> changedTiles_;                //!< The tiles that changed since the last generation
+        int rows_;                                       //!< The number of rows in the grid the list was built from
+        int colms_;                                      //!< The number of columns in the grid the list was built from
+        int gridId_;                                     //!< The object id of the grid the list was built from (-1 if not built)
+        Uint64 version_;                                 //!< The version of the grid the list was built from
+        const Grid* streamedGrid_;                       //!< The streamed grid the neighbours are found in (nullptr if not streamed)
+        mutable Index streamedNeighbours_[MAX_NEIGHBOURS]; //!< The last neighbours found in the streamed grid
     };
 }
 
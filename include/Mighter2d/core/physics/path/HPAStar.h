@@ -0,0 +1,261 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_HPASTAR_H
+#define MIGHTER2D_HPASTAR_H
+
+#include "IPathFinderStrategy.h"
+#include "Mighter2d/common/Vector2.h"
+#include <vector>
+
+namespace mighter2d {
+    /**
+     * @brief Finds a path in a Grid using Hierarchical Path-Finding A* (HPA*)
+     *
+     * The grid is split into square clusters. Where two neighbouring
+     * clusters can be crossed, one or two tiles on each side of their
+     * border are chosen as entrances, and the cheapest cost between every
+     * two entrances of a cluster is computed ahead of time. A path is
+     * found by searching this much smaller graph of entrances first and
+     * then finding the tiles between consecutive entrances, which only
+     * requires searching inside a single cluster.
+     *
+     * The precomputed data is built the first time a path is requested in
+     * a grid. Afterwards, only the clusters containing the tiles that
+     * changed (see Grid::getChangedTiles) and, for tiles on a border, the
+     * clusters on the other side of the border are rebuilt.
+     *
+     * A tile can be entered if it is not collidable and does not contain
+     * an active obstacle, and the path only moves horizontally and
+     * vertically. The movement costs of the grid are taken into account.
+     * Since the path has to go through the entrances, it may be longer
+     * than the paths found by mighter2d::AStar (usually by a few percent),
+     * in return for being found much faster on large grids
+     */
+    class MIGHTER2D_API HPAStar : public IPathFinderStrategy {
+    public:
+        /**
+         * @brief Initialize the algorithm
+         * @param gridSize Size of the grid in tiles
+         * @param clusterSize The width and height of a cluster in tiles
+         *
+         * Smaller clusters make the precomputed data quicker to build
+         * and to update, while larger clusters make the graph of
+         * entrances smaller and the search quicker
+         */
+        explicit HPAStar(const Vector2u& gridSize, unsigned int clusterSize = 16);
+
+        /**
+         * @brief Get the width and height of a cluster
+         * @return The width and height of a cluster in tiles
+         */
+        unsigned int getClusterSize() const;
+
+        /**
+         * @brief Generate a path from a source tile to a target tile in a grid
+         * @param grid Grid to find path in
+         * @param sourceTile The position of the starting position in tiles
+         * @param targetTile The position of the destination in tiles
+         * @return The path from the source to the destination if reachable,
+         *         otherwise an empty path
+         */
+        std::stack<Index> findPath(const Grid& grid, const Index& sourceTile,
+                                   const Index& targetTile) override;
+
+        /**
+         * @brief Get the number of entrances in the last searched grid
+         * @return The number of entrances
+         */
+        std::size_t getEntranceCount() const;
+
+        /**
+         * @brief Get the number of entrances expanded by the last search
+         * @return The number of entrances expanded by the last call to findPath
+         */
+        std::size_t getExpandedCount() const;
+
+        /**
+         * @brief Get the type of path finding algorithm
+         * @return The type of the path finding algorithm
+         */
+        std::string getType() const override;
+
+        /**
+         * @brief Get the settings that change the paths found by the algorithm
+         * @return The size of the clusters
+         */
+        std::string getSettings() const override;
+
+    private:
+        /**
+         * @brief The entrances of a cluster
+         */
+        struct Cluster {
+            std::vector<std::size_t> entrances; //!< Row-major position of each entrance tile
+            std::vector<float> costs;           //!< The cheapest cost from each entrance to each entrance (row = from)
+        };
+
+        /**
+         * @brief A node in the open set of a search
+         */
+        struct OpenNode {
+            float fScore;      //!< The cost from the source plus the estimated cost to the target
+            float gScore;      //!< The cost from the source when the node was added
+            std::size_t node;  //!< The node (an entrance, the source or the target)
+        };
+
+        /**
+         * @brief A tile in the open set of a search inside a cluster
+         */
+        struct LocalNode {
+            float priority; //!< The cost from the start of the search plus the estimated cost to the target
+            float cost;     //!< The cost from the start of the search
+            int index;      //!< The position of the tile in the cluster
+        };
+
+        /**
+         * @brief Update the precomputed data after the grid changed
+         * @param grid The grid to find paths in
+         */
+        void update(const Grid& grid);
+
+        /**
+         * @brief Mark a cluster for rebuilding
+         * @param cluster The cluster to mark
+         */
+        void markDirty(std::size_t cluster);
+
+        /**
+         * @brief Mark the clusters affected by a change of a tile for rebuilding
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         */
+        void markTileDirty(int row, int colm);
+
+        /**
+         * @brief Rebuild the entrances and costs of the clusters marked for rebuilding
+         */
+        void rebuildDirtyClusters();
+
+        /**
+         * @brief Find the entrances of a cluster
+         * @param cluster The cluster to find the entrances of
+         */
+        void findEntrances(std::size_t cluster);
+
+        /**
+         * @brief Find the entrances on the border between two clusters
+         * @param firstRow The row of the first tile on the near side of the border
+         * @param firstColm The column of the first tile on the near side of the border
+         * @param length The number of tiles along the border
+         * @param isVertical True if the border is vertical (the far side is to the right),
+         *                   false if it is horizontal (the far side is below)
+         * @param isNearSide True to add the near side tile of each entrance, false to add the far side tile
+         * @param entrances The entrances to add to
+         */
+        void findBorderEntrances(int firstRow, int firstColm, int length, bool isVertical,
+                                 bool isNearSide, std::vector<std::size_t>& entrances) const;
+
+        /**
+         * @brief Copy the accessibility and movement costs of the tiles of a cluster
+         * @param cluster The cluster to copy
+         *
+         * The copy lets the searches inside a cluster use positions in the
+         * cluster instead of positions in the grid
+         */
+        void loadCluster(std::size_t cluster);
+
+        /**
+         * @brief Find the cheapest cost from (or to) a tile to every tile of its cluster
+         * @param cluster The cluster to search, it must contain @a tile
+         * @param tile The row-major position of the tile to search from
+         * @param target The tile at which to stop the search or the number of tiles in the grid to search the whole cluster
+         *               (a search with a target expands the tiles closer to the target first)
+         * @param isReversed True to find the costs to @a tile instead of from it
+         *
+         * The costs are stored in localCosts_ and the tile each tile is
+         * reached from in localParents_, by position in the cluster
+         */
+        void searchCluster(std::size_t cluster, std::size_t tile, std::size_t target, bool isReversed);
+
+        /**
+         * @brief Get the cluster a tile belongs to
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return The cluster of the tile
+         */
+        std::size_t getCluster(int row, int colm) const;
+
+        /**
+         * @brief Get the position of a tile in its cluster
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return The position of the tile in its cluster
+         */
+        std::size_t getLocalIndex(int row, int colm) const;
+
+        /**
+         * @brief Check if a tile can be entered
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return True if the tile is in the grid and can be entered
+         */
+        bool isAccessible(int row, int colm) const;
+
+    private:
+        int clusterSize_;                            //!< The width and height of a cluster in tiles
+        const Grid* grid_;                           //!< The grid being searched
+        int gridId_;                                 //!< The object id of the grid the data was built from (-1 if not built)
+        Uint64 version_;                             //!< The version of the grid the data was built from
+        int rows_;                                   //!< The number of rows in the grid the data was built from
+        int colms_;                                  //!< The number of columns in the grid the data was built from
+        int clusterRows_;                            //!< The number of rows of clusters
+        int clusterColms_;                           //!< The number of columns of clusters
+        std::vector<unsigned char> accessible_;      //!< Whether or not each tile can be entered
+        std::vector<int> entranceSlots_;             //!< The position of each tile in the entrances of its cluster (-1 if not an entrance)
+        std::vector<Cluster> clusters_;              //!< The entrances of each cluster
+        std::vector<std::size_t> firstNodes_;        //!< The node of the first entrance of each cluster
+        std::vector<std::size_t> nodeTiles_;         //!< The tile of each node
+        std::vector<unsigned char> isClusterDirty_;  //!< Whether or not each cluster must be rebuilt
+        std::vector<std::size_t> dirtyClusters_;     //!< The clusters that must be rebuilt
+        std::vector<Index> changedTiles_;            //!< The tiles that changed since the data was built
+        std::size_t loadedCluster_;                  //!< The cluster whose tiles are copied in localAccessible_ and localMoveCosts_
+        std::vector<unsigned char> localAccessible_; //!< Whether or not each tile of the loaded cluster can be entered
+        std::vector<float> localMoveCosts_;          //!< The movement cost of each tile of the loaded cluster
+        std::vector<float> localCosts_;              //!< The costs found by the last search inside a cluster
+        std::vector<int> localParents_;              //!< The position each tile is reached from in the last search inside a cluster
+        std::vector<LocalNode> localOpenSet_;        //!< Binary heap of the tiles to be expanded in a search inside a cluster
+        std::vector<float> sourceCosts_;             //!< The cheapest cost from the source to each entrance of its cluster
+        std::vector<float> targetCosts_;             //!< The cheapest cost from each entrance of its cluster to the target
+        std::vector<float> gScores_;                 //!< The cheapest known cost from the source to each node
+        std::vector<std::size_t> parents_;           //!< The node each node is reached from on its cheapest known path
+        std::vector<unsigned int> openedIn_;         //!< The search in which each node was last reached
+        std::vector<unsigned int> closedIn_;         //!< The search in which each node was last expanded
+        std::vector<OpenNode> openSet_;              //!< Binary heap of the nodes to be expanded
+        unsigned int searchId_;                      //!< Identifies the current search, so the arrays need not be cleared
+        std::size_t expandedCount_;                  //!< The number of nodes expanded by the last search
+    };
+}
+
+#endif // MIGHTER2D_HPASTAR_H
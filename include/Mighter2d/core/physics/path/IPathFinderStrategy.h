@@ -56,6 +56,16 @@ namespace mighter2d {
          */
         virtual std::string getType() const = 0;
 
+        /**
+         * @brief Get the settings that change the paths found by the algorithm
+         * @return The settings of the algorithm
+         *
+         * Path finders of the same type only find the same paths if their
+         * settings are the same, see PathCache. By default, this function
+         * returns an empty string
+         */
+        virtual std::string getSettings() const;
+
         /**
          * @brief Destructor
          */
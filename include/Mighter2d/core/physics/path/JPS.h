@@ -0,0 +1,201 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_JPS_H
+#define MIGHTER2D_JPS_H
+
+#include "IPathFinderStrategy.h"
+#include "Mighter2d/core/physics/GridMover.h"
+#include "Mighter2d/common/Vector2.h"
+#include <vector>
+
+namespace mighter2d {
+    /**
+     * @brief Finds a path in a Grid using Jump Point Search
+     *
+     * Jump Point Search is an optimization of A* for grids in which every
+     * tile costs the same to enter. Instead of adding every neighbour of
+     * an expanded tile to the open set, it skips ("jumps") along straight
+     * and diagonal lines until it reaches a tile at which the path may
+     * have to turn, so on open grids only a handful of tiles are expanded
+     * per path. The paths it finds are as short as the paths found by
+     * mighter2d::BFS (4 directions) or mighter2d::AStar with the Octile
+     * heuristic (8 directions).
+     *
+     * A tile can be entered if it is not collidable and does not contain
+     * an active obstacle. The movement costs of the grid are ignored, use
+     * mighter2d::AStar if the tiles have different movement costs.
+     *
+     * The moves that are allowed are given by a GridMover::MoveRestriction:
+     * with MoveRestriction::NonDiagonal the path only moves horizontally
+     * and vertically, and with MoveRestriction::None it may also move
+     * diagonally. A diagonal move costs sqrt(2) and it is only allowed if
+     * both tiles beside it can be entered, so the path never cuts the
+     * corner of a blocked tile
+     */
+    class MIGHTER2D_API JPS : public IPathFinderStrategy {
+    public:
+        /**
+         * @brief Initialize the algorithm
+         * @param gridSize Size of the grid in tiles
+         * @param moveRestriction The moves the path may be made of
+         *
+         * @a moveRestriction must be either GridMover::MoveRestriction::None
+         * or GridMover::MoveRestriction::NonDiagonal
+         */
+        explicit JPS(const Vector2u& gridSize,
+            GridMover::MoveRestriction moveRestriction = GridMover::MoveRestriction::NonDiagonal);
+
+        /**
+         * @brief Set the moves the path may be made of
+         * @param moveRestriction The moves the path may be made of
+         *
+         * @a moveRestriction must be either GridMover::MoveRestriction::None
+         * (8 directions) or GridMover::MoveRestriction::NonDiagonal (4
+         * directions). By default, the move restriction is
+         * GridMover::MoveRestriction::NonDiagonal
+         */
+        void setMoveRestriction(GridMover::MoveRestriction moveRestriction);
+
+        /**
+         * @brief Get the moves the path may be made of
+         * @return The moves the path may be made of
+         */
+        GridMover::MoveRestriction getMoveRestriction() const;
+
+        /**
+         * @brief Generate a path from a source tile to a target tile in a grid
+         * @param grid Grid to find path in
+         * @param sourceTile The position of the starting position in tiles
+         * @param targetTile The position of the destination in tiles
+         * @return The path from the source to the destination if reachable,
+         *         otherwise an empty path
+         *
+         * The path contains every tile between the jump points, so it can
+         * be followed one tile at a time like the paths of the other path
+         * finders
+         */
+        std::stack<Index> findPath(const Grid& grid, const Index& sourceTile,
+                                   const Index& targetTile) override;
+
+        /**
+         * @brief Get the number of jump points expanded by the last search
+         * @return The number of jump points expanded by the last call to findPath
+         */
+        std::size_t getExpandedCount() const;
+
+        /**
+         * @brief Get the type of path finding algorithm
+         * @return The type of the path finding algorithm
+         */
+        std::string getType() const override;
+
+        /**
+         * @brief Get the settings that change the paths found by the algorithm
+         * @return The name of the move restriction
+         */
+        std::string getSettings() const override;
+
+    private:
+        /**
+         * @brief A jump point in the open set
+         */
+        struct OpenNode {
+            float fScore;      //!< The cost from the source plus the estimated cost to the target
+            float gScore;      //!< The cost from the source when the node was added
+            std::size_t tile;  //!< Row-major position of the tile
+        };
+
+        /**
+         * @brief Check if a tile can be entered
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return True if the tile is in the grid and can be entered
+         *
+         * The result is cached for the duration of the search
+         */
+        bool isWalkable(int row, int colm);
+
+        /**
+         * @brief Move from a tile in a direction until a jump point is found
+         * @param row The row of the tile to move from
+         * @param colm The column of the tile to move from
+         * @param rowDir The row direction of the move (-1, 0 or 1)
+         * @param colmDir The column direction of the move (-1, 0 or 1)
+         * @param jumpPoint Set to the jump point if one is found
+         * @return True if a jump point was found, otherwise false
+         */
+        bool jump(int row, int colm, int rowDir, int colmDir, Index& jumpPoint);
+
+        /**
+         * @brief Move in a straight line until a jump point is found
+         * @param row The row of the first tile on the line
+         * @param colm The column of the first tile on the line
+         * @param rowDir The row direction of the move (-1, 0 or 1)
+         * @param colmDir The column direction of the move (-1, 0 or 1)
+         * @param jumpPoint Set to the jump point if one is found
+         * @return True if a jump point was found, otherwise false
+         */
+        bool jumpStraight(int row, int colm, int rowDir, int colmDir, Index& jumpPoint);
+
+        /**
+         * @brief Add the jump points reachable from an expanded tile to the open set
+         * @param node The expanded tile
+         * @param row The row of the expanded tile
+         * @param colm The column of the expanded tile
+         */
+        void addSuccessors(const OpenNode& node, int row, int colm);
+
+        /**
+         * @brief Estimate the cost from a tile to the target
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return The estimated cost
+         */
+        float estimate(int row, int colm) const;
+
+        /**
+         * @brief Make the flat arrays large enough for a grid
+         * @param tileCount The number of tiles in the grid
+         */
+        void resize(std::size_t tileCount);
+
+    private:
+        GridMover::MoveRestriction moveRestriction_; //!< The moves the path may be made of
+        const Grid* grid_;                           //!< The grid being searched
+        Index target_;                               //!< The target of the current search
+        std::size_t colms_;                          //!< The number of columns in the grid being searched
+        std::vector<float> gScores_;                 //!< The cheapest known cost from the source to each jump point
+        std::vector<std::size_t> parents_;           //!< The jump point each jump point is reached from
+        std::vector<unsigned int> openedIn_;         //!< The search in which each tile was last reached
+        std::vector<unsigned int> closedIn_;         //!< The search in which each tile was last expanded
+        std::vector<unsigned int> checkedIn_;        //!< The search in which each tile was last checked for walkability
+        std::vector<bool> walkable_;                 //!< Whether or not each checked tile can be entered
+        std::vector<OpenNode> openSet_;              //!< Binary heap of the jump points to be expanded
+        unsigned int searchId_;                      //!< Identifies the current search, so the arrays need not be cleared
+        std::size_t expandedCount_;                  //!< The number of jump points expanded by the last search
+    };
+}
+
+#endif // MIGHTER2D_JPS_H
@@ -0,0 +1,216 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_PATHCACHE_H
+#define MIGHTER2D_PATHCACHE_H
+
+#include "Mighter2d/Config.h"
+#include "Mighter2d/core/physics/GridMover.h"
+#include "Mighter2d/core/grid/Index.h"
+#include <list>
+#include <stack>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace mighter2d {
+    class Grid;
+
+    /**
+     * @brief Remembers the most recently found paths in a Grid
+     *
+     * A path is stored with the source tile, the target tile, the movement
+     * restriction of the mover and the type and settings of the path finder
+     * it was found by (see IPathFinderStrategy::getType and
+     * IPathFinderStrategy::getSettings), and it is reused when a path with
+     * the same key is needed again. Unreachable targets are remembered as
+     * empty paths.
+     *
+     * When the cache is used after the grid changed (see Grid::getVersion),
+     * the paths that cross or move diagonally past a changed tile are removed (see
+     * Grid::getChangedTiles), as well as the empty paths whose target
+     * became reachable (see Grid::isReachable). A path is also removed
+     * when a changed tile that can be entered lies within the rectangle
+     * bounding the source, the target and the path, grown by one tile,
+     * since a shorter path may lead through that tile. The remaining
+     * paths can still be walked, however a cheaper path that detours
+     * outside that rectangle is not detected. The cache is emptied if the change log of the grid cannot tell what
+     * changed or if the cache is used with a different grid. When the
+     * cache is full, the least recently used path is replaced.
+     *
+     * A cache can be shared by the movers of the same grid, see
+     * TargetGridMover::setPathCache
+     */
+    class MIGHTER2D_API PathCache {
+    public:
+        /**
+         * @brief Identifies a path in the cache
+         */
+        struct Key {
+            Index source;                            //!< The tile the path starts from
+            Index target;                            //!< The tile the path leads to
+            GridMover::MoveRestriction restriction;  //!< The movement restriction of the mover
+            std::string pathFinderType;              //!< The type of path finder that found the path
+            std::string pathFinderSettings;          //!< The settings of the path finder that found the path
+
+            /**
+             * @brief Check if two keys are the same
+             * @param other The key to compare against
+             * @return True if the keys are the same, otherwise false
+             */
+            bool operator==(const Key& other) const;
+        };
+
+        /**
+         * @brief Constructor
+         * @param capacity The maximum number of paths in the cache
+         */
+        explicit PathCache(std::size_t capacity = 256);
+
+        /**
+         * @brief Find a path in the cache
+         * @param grid The grid the path is needed in
+         * @param key The key of the path
+         * @return The path or a nullptr if the path is not in the cache
+         *
+         * A found path becomes the most recently used path. The returned
+         * pointer is invalidated by the next call to a non const function
+         */
+        const std::stack<Index>* find(const Grid& grid, const Key& key);
+
+        /**
+         * @brief Add a path to the cache
+         * @param grid The grid the path was found in
+         * @param key The key of the path
+         * @param path The path from the source to the target
+         *
+         * If the cache already has a path with the same key, it is replaced
+         */
+        void insert(const Grid& grid, const Key& key, const std::stack<Index>& path);
+
+        /**
+         * @brief Set the maximum number of paths in the cache
+         * @param capacity The maximum number of paths in the cache
+         *
+         * If the cache has more paths than @a capacity, the least recently
+         * used paths are removed. The capacity must be greater than zero
+         *
+         * By default, the capacity is 256
+         */
+        void setCapacity(std::size_t capacity);
+
+        /**
+         * @brief Get the maximum number of paths in the cache
+         * @return The maximum number of paths in the cache
+         */
+        std::size_t getCapacity() const;
+
+        /**
+         * @brief Get the number of paths in the cache
+         * @return The number of paths in the cache
+         */
+        std::size_t getSize() const;
+
+        /**
+         * @brief Get the number of times a path was found in the cache
+         * @return The number of calls to find() that returned a path
+         */
+        std::size_t getHitCount() const;
+
+        /**
+         * @brief Get the number of times a path was not found in the cache
+         * @return The number of calls to find() that returned a nullptr
+         */
+        std::size_t getMissCount() const;
+
+        /**
+         * @brief Remove all the paths from the cache
+         */
+        void clear();
+
+    private:
+        /**
+         * @brief Hashes a key
+         */
+        struct KeyHash {
+            /**
+             * @brief Get the hash of a key
+             * @param key The key to be hashed
+             * @return The hash of the key
+             */
+            std::size_t operator()(const Key& key) const;
+        };
+
+        /**
+         * @brief A path and the key it is stored under
+         */
+        struct Entry {
+            Key key;                  //!< The key of the path
+            std::stack<Index> path;   //!< The path from the source to the target
+            std::vector<Index> tiles; //!< The tiles the path crosses or moves diagonally past
+            Index topLeft;            //!< The top left corner of the rectangle bounding the path, grown by one tile
+            Index bottomRight;        //!< The bottom right corner of the rectangle bounding the path, grown by one tile
+        };
+
+        /**
+         * @brief Remove the paths that are out of date
+         * @param grid The grid the cache is used with
+         */
+        void validate(const Grid& grid);
+
+        /**
+         * @brief Check whether or not a path may have changed since it was found
+         * @param grid The grid the path was found in
+         * @param entry The path
+         * @return True if the path crosses or moves diagonally past a changed
+         *         tile, if a changed tile that can be entered lies within
+         *         the bounding rectangle of the path, or if the path is empty
+         *         and its target became reachable, otherwise false
+         */
+        bool isOutdated(const Grid& grid, const Entry& entry) const;
+
+        /**
+         * @brief Make an entry
+         * @param key The key of the path
+         * @param path The path from the source to the target
+         * @return The entry
+         */
+        static Entry makeEntry(const Key& key, const std::stack<Index>& path);
+
+    private:
+        std::size_t capacity_;     //!< The maximum number of paths in the cache
+        std::list<Entry> entries_; //!< The paths, from the most to the least recently used
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> lookup_; //!< The position of each path in the list
+        unsigned int gridId_;      //!< The object id of the grid the paths were found in
+        Uint64 version_;           //!< The version of the grid the paths were last validated at
+        std::vector<Index> changedTiles_; //!< The tiles changed since the last validation
+        std::unordered_set<Index> changedTileSet_; //!< The tiles changed since the last validation, for lookups
+        std::vector<Index> enterableTiles_; //!< The changed tiles that can be entered since the last validation
+        std::size_t hitCount_;     //!< The number of paths found in the cache
+        std::size_t missCount_;    //!< The number of paths not found in the cache
+    };
+}
+
+#endif // MIGHTER2D_PATHCACHE_H
@@ -0,0 +1,325 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_PATHSERVICE_H
+#define MIGHTER2D_PATHSERVICE_H
+
+#include "Mighter2d/Config.h"
+#include "Mighter2d/core/object/Object.h"
+#include "Mighter2d/common/IUpdatable.h"
+#include "Mighter2d/core/physics/path/AStar.h"
+#include "Mighter2d/core/grid/Index.h"
+#include "Mighter2d/common/Vector2.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stack>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace mighter2d {
+    class Grid;
+
+    /**
+     * @brief Finds paths in a Grid on background threads
+     *
+     * A path request is not solved immediately. It is queued, solved on
+     * one of the worker threads of the service using the A* algorithm
+     * (see mighter2d::AStar) and its result is delivered on a later
+     * frame, on the thread that updates the scene. This keeps expensive
+     * searches out of the frame when many paths are requested at the
+     * same time.
+     *
+     * Each worker searches its own copy of the tiles that can be entered
+     * and their movement costs. When a request is made after the grid
+     * changed (see Grid::getVersion), the service records the state of
+     * the changed tiles only (see Grid::getChangedTiles) and the workers
+     * apply these changes to their copies before solving the request.
+     * The whole grid is only copied when its change log cannot tell what
+     * changed or when the recorded changes add up to the size of the grid.
+     * A request is solved on the state of the grid at the time of the
+     * request. Since the delivered path was found on an older state of
+     * the grid, it may be blocked by the time it is delivered
+     *
+     * @warning The workers need a copy of the whole grid, so a path service
+     * cannot be used with a streamed grid (see Grid::streamFromFile)
+     *
+     * @code
+     * auto pathService = mighter2d::PathService::create(grid);
+     * pathService->requestPath({0, 0}, {10, 10}, [](const std::stack<mighter2d::Index>& path) {
+     *      // Use the path
+     * });
+     * @endcode
+     *
+     * @see TargetGridMover::setPathService
+     */
+    class MIGHTER2D_API PathService : public Object, public IUpdatable {
+    public:
+        using Ptr = std::unique_ptr<PathService>; //!< Unique path service pointer
+
+        /**
+         * @brief Constructor
+         * @param grid The grid to find paths in
+         * @param threadCount The number of worker threads solving requests
+         * @param heuristic The estimate of the remaining cost to the target
+         *
+         * The heuristic determines the moves that are allowed in a path,
+         * see AStar::Heuristic
+         */
+        explicit PathService(Grid& grid, unsigned int threadCount = 1,
+            AStar::Heuristic heuristic = AStar::Heuristic::Manhattan);
+
+        /**
+         * @brief Create a path service
+         * @param grid The grid to find paths in
+         * @param threadCount The number of worker threads solving requests
+         * @param heuristic The estimate of the remaining cost to the target
+         * @return The created path service
+         */
+        static PathService::Ptr create(Grid& grid, unsigned int threadCount = 1,
+            AStar::Heuristic heuristic = AStar::Heuristic::Manhattan);
+
+        /**
+         * @brief Copy constructor
+         */
+        PathService(const PathService&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        PathService& operator=(const PathService&) = delete;
+
+        /**
+         * @brief Get the name of this class
+         * @return The name of this class
+         */
+        std::string getClassName() const override;
+
+        /**
+         * @brief Get the number of worker threads solving requests
+         * @return The number of worker threads
+         */
+        unsigned int getThreadCount() const;
+
+        /**
+         * @brief Request a path from a source tile to a target tile
+         * @param sourceTile The position of the starting position in tiles
+         * @param targetTile The position of the destination in tiles
+         * @param callback Function to execute when the path is found
+         * @return The identification number of the request
+         *
+         * The callback is passed the path from the source to the target,
+         * which is empty if the target cannot be reached (see
+         * IPathFinderStrategy::findPath). It is executed by update() on a
+         * later frame, never during this call. Requests for unreachable
+         * targets (see Grid::isReachable) are answered without a search
+         *
+         * @see cancelRequest and setMaxResultsPerFrame
+         */
+        int requestPath(const Index& sourceTile, const Index& targetTile,
+            const Callback<const std::stack<Index>&>& callback);
+
+        /**
+         * @brief Cancel a path request
+         * @param id The identification number of the request
+         * @return True if the request was cancelled or false if the
+         *         request does not exist or its result was already delivered
+         *
+         * The callback of a cancelled request is never executed
+         */
+        bool cancelRequest(int id);
+
+        /**
+         * @brief Get the number of requests whose result is not yet delivered
+         * @return The number of pending requests
+         */
+        std::size_t getPendingCount() const;
+
+        /**
+         * @brief Set the maximum number of results delivered per frame
+         * @param maxResults The maximum number of results delivered per frame
+         *
+         * Results that are ready but exceed the limit are delivered on the
+         * following frames, in the order in which they were solved. This
+         * spreads the cost of applying the paths when many requests finish
+         * at the same time. The limit must be greater than zero
+         *
+         * By default, up to 32 results are delivered per frame
+         */
+        void setMaxResultsPerFrame(unsigned int maxResults);
+
+        /**
+         * @brief Get the maximum number of results delivered per frame
+         * @return The maximum number of results delivered per frame
+         *
+         * @see setMaxResultsPerFrame
+         */
+        unsigned int getMaxResultsPerFrame() const;
+
+        /**
+         * @internal
+         * @brief Deliver the results of the solved requests
+         * @param deltaTime Time passed since last update
+         *
+         * @warning This function is intended for internal use only and
+         * should never be called outside of Mighter2d
+         */
+        void update(Time deltaTime) override;
+
+        /**
+         * @brief Destructor
+         *
+         * Joins the worker threads. The requests whose results are not
+         * yet delivered are discarded
+         */
+        ~PathService() override;
+
+    private:
+        /**
+         * @brief The state of a tile at the time a change was recorded
+         */
+        struct TileState {
+            std::size_t tile;  //!< Row-major position of the tile
+            bool isAccessible; //!< Whether or not the tile can be entered
+            float cost;        //!< The movement cost of the tile
+        };
+
+        /**
+         * @brief A copy of the tiles of the grid
+         *
+         * Provides the functions the A* search reads a Grid with
+         */
+        struct Snapshot {
+            unsigned int rows = 0;                 //!< The number of rows in the grid
+            unsigned int colms = 0;                //!< The number of columns in the grid
+            std::vector<unsigned char> accessible; //!< Whether or not each tile can be entered, in row-major order
+            std::vector<float> costs;              //!< The movement cost of each tile, in row-major order
+
+            /**
+             * @brief Get the size of the grid in tiles
+             * @return The number of columns (x) and rows (y)
+             */
+            Vector2u getSizeInTiles() const;
+
+            /**
+             * @brief Check if an index is within the bounds of the grid
+             * @param index The index to be checked
+             * @return True if the index is valid, otherwise false
+             */
+            bool isIndexValid(const Index& index) const;
+
+            /**
+             * @brief Check whether or not a tile could be entered when the copy was made
+             * @param index The index of the tile
+             * @return True if the index is valid and the tile could be entered
+             */
+            bool isTileAccessible(const Index& index) const;
+
+            /**
+             * @brief Get the movement cost of a tile when the copy was made
+             * @param index The index of the tile
+             * @return The movement cost of the tile
+             */
+            float getMovementCost(const Index& index) const;
+
+            /**
+             * @brief Update a tile of the copy
+             * @param state The state of the tile
+             */
+            void setTile(const TileState& state);
+        };
+
+        /**
+         * @brief The tiles that changed between two versions of the grid
+         */
+        struct Delta {
+            Uint64 sequence;                          //!< Position of the delta in the sequence of recorded deltas
+            std::shared_ptr<const Snapshot> snapshot; //!< All the tiles of the grid, or nullptr if only some tiles changed
+            std::vector<TileState> changes;           //!< The state of the changed tiles when the snapshot is nullptr
+        };
+
+        /**
+         * @brief A request waiting for a worker
+         */
+        struct Request {
+            int id;          //!< The identification number of the request
+            Index source;    //!< The tile the path starts from
+            Index target;    //!< The tile the path leads to
+            Uint64 sequence; //!< The last delta recorded before the request was made
+        };
+
+        /**
+         * @brief A solved request waiting to be delivered
+         */
+        struct Result {
+            int id;                 //!< The identification number of the request
+            std::stack<Index> path; //!< The path from the source to the target
+        };
+
+        /**
+         * @brief The copy of the grid and the search arrays of a worker thread
+         */
+        struct SearchState;
+
+        /**
+         * @brief Record the tiles that changed since the last recorded delta
+         */
+        void recordChanges();
+
+        /**
+         * @brief Get the current state of a tile
+         * @param index The index of the tile
+         * @return The current state of the tile
+         */
+        TileState getTileState(const Index& index) const;
+
+        /**
+         * @brief Loop executed by a worker thread
+         */
+        void workerLoop();
+
+    private:
+        Grid* grid_;                               //!< The grid to find paths in
+        AStar::Heuristic heuristic_;               //!< The estimate of the remaining cost to the target
+        unsigned int maxResultsPerFrame_;          //!< The maximum number of results delivered per frame
+        int requestCounter_;                       //!< Generates the identification numbers of the requests
+        int gridDestructionId_;                    //!< The id of the grids destruction listener
+        Uint64 gridVersion_;                       //!< The version of the grid when the last delta was recorded
+        Vector2u gridSize_;                        //!< The size of the grid when the last delta was recorded
+        Uint64 deltaCounter_;                      //!< Generates the sequence numbers of the deltas
+        std::size_t changesSinceCopy_;             //!< The number of tile changes recorded since the grid was last copied
+        std::vector<Index> changedTiles_;          //!< The tiles modified since the last delta was recorded
+        std::unordered_map<int, Callback<const std::stack<Index>&>> callbacks_; //!< The callbacks of the pending requests
+        std::vector<std::thread> workers_;         //!< Worker threads
+        std::mutex mutex_;                         //!< Guards the state shared with the workers
+        std::condition_variable requestReady_;     //!< Wakes up the workers when a request is queued
+        std::deque<Request> requests_;             //!< Requests waiting for a worker
+        std::deque<std::shared_ptr<const Delta>> deltas_; //!< The deltas the queued requests may need, starting with a copy of the grid
+        std::deque<Result> results_;               //!< Solved requests waiting to be delivered
+        bool isStopping_;                          //!< A flag indicating whether or not the workers must exit
+    };
+}
+
+#endif // MIGHTER2D_PATHSERVICE_H
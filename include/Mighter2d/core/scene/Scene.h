@@ -53,6 +53,7 @@ namespace mighter2d {
     /// @internal
     namespace priv {
        class SceneManager;
+       class CollisionManager;
     }
 
     /**
@@ -439,6 +440,109 @@ namespace mighter2d {
          */
         float getTimescale() const;
 
+        /**
+         * @brief Set the size of the collision grid cells
+         * @param size The width and height of a cell in pixels
+         * @throws InvalidArgumentException If @a size is not greater than zero
+         *
+         * Before the scene tests its collidables for overlaps, it places
+         * them in a uniform grid and only tests collidables that share a
+         * grid cell. For best performance, the cell size should be slightly
+         * larger than the size of a typical collidable in the scene. Note
+         * that collidables that span a lot of cells are tested against
+         * every other collidable
+         *
+         * By default, the cell size is 64 pixels
+         *
+         * @see getCollisionCellSize
+         */
+        void setCollisionCellSize(float size);
+
+        /**
+         * @brief Get the size of the collision grid cells
+         * @return The width and height of a cell in pixels
+         *
+         * @see setCollisionCellSize
+         */
+        float getCollisionCellSize() const;
+
+        /**
+         * @brief Set the number of threads the collision tests are split across
+         * @param count The number of threads, including the main thread
+         * @throws InvalidArgumentException If @a count is zero
+         *
+         * When the scene has a lot of overlapping or nearly overlapping
+         * collidables, testing them for overlaps can be split across
+         * multiple threads. Only the overlap tests run on the extra
+         * threads; the collision callbacks (see mighter2d::Collidable::onOverlapStart)
+         * are always invoked on the main thread and in the same order
+         * regardless of the thread count, so game code does not need
+         * to be thread safe.
+         *
+         * @code
+         * // Use all the cores of the CPU
+         * scene.setCollisionThreadCount(std::max(1u, std::thread::hardware_concurrency()));
+         * @endcode
+         *
+         * By default, the collision tests run on the main thread only
+         *
+         * @see getCollisionThreadCount
+         */
+        void setCollisionThreadCount(unsigned int count);
+
+        /**
+         * @brief Get the number of threads the collision tests are split across
+         * @return The number of threads, including the main thread
+         *
+         * @see setCollisionThreadCount
+         */
+        unsigned int getCollisionThreadCount() const;
+
+        /**
+         * @brief Find all the collidables whose bounding box overlaps a rectangle
+         * @param rect The rectangle to be tested, in world coordinates
+         * @param callback Function called for every overlapping collidable
+         *
+         * This function does not iterate over all the collidables in the
+         * scene, the collidables are kept in a bounding volume hierarchy,
+         * so only collidables in the vicinity of @a rect are visited.
+         *
+         * @code
+         * // Damage everything caught in an explosion
+         * scene.queryAABB({x - radius, y - radius, radius * 2, radius * 2}, [](mighter2d::Collidable& collidable) {
+         *      // Apply damage
+         * });
+         * @endcode
+         *
+         * @see queryPoint, raycast
+         */
+        void queryAABB(const FloatRect& rect, const Callback<Collidable&>& callback);
+
+        /**
+         * @brief Find all the collidables whose bounding box contains a point
+         * @param point The point to be tested, in world coordinates
+         * @param callback Function called for every collidable containing the point
+         *
+         * @see queryAABB, raycast
+         */
+        void queryPoint(const Vector2f& point, const Callback<Collidable&>& callback);
+
+        /**
+         * @brief Find all the collidables whose bounding box is crossed by a line segment
+         * @param from The start point of the segment, in world coordinates
+         * @param to The end point of the segment, in world coordinates
+         * @param callback Function called for every crossed collidable
+         *
+         * The callback is passed the collidable and the fraction of the
+         * segment at which the segment enters the collidable's bounding
+         * box, in the range [0, 1]. The callback is invoked in order of
+         * increasing fraction, that is, the collidable closest to @a from
+         * is reported first
+         *
+         * @see queryAABB, queryPoint
+         */
+        void raycast(const Vector2f& from, const Vector2f& to, const Callback<Collidable&, float>& callback);
+
         /**
          * @brief Get a reference to the game engine
          * @return A reference to the game engine
@@ -602,6 +706,15 @@ namespace mighter2d {
          */
         bool removeCollidable(Collidable* collidable);
 
+        /**
+         * @internal
+         * @brief Notify the scene that the bounding box of a collidable changed
+         * @param collidable The collidable whose bounding box changed
+         *
+         * @warning This function is intended for internal use only
+         */
+        void updateCollidable(Collidable* collidable);
+
         /**
          * @internal
          * @brief Add a system event handler to the event list
@@ -691,7 +804,6 @@ namespace mighter2d {
 
     private:
         std::vector<IUpdatable*> updateList_; //!< Update list
-        std::vector<Collidable*> collidableList_; //!< Update list
         std::vector<ISystemEventHandler*> systemEventHandlerList_; //!< Update list
         Engine* engine_;                      //!< Game engine
         std::unique_ptr<Camera> camera_;      //!< Scene level camera
@@ -705,6 +817,7 @@ namespace mighter2d {
         bool isVisibleWhenPaused_;            //!< A flag indicating whether or not the scene is rendered behind the active scene when it is paused
         std::pair<bool, std::string> cacheState_;
         std::unique_ptr<BackgroundScene> backgroundScene_; //!< The background scene of this scene
+        std::unique_ptr<priv::CollisionManager> collisionManager_; //!< Detects overlaps between the scene collidables
 
         friend class priv::SceneManager;      //!< Pre updates the scene
     };
@@ -49,11 +49,17 @@ namespace mighter2d {
 
         /**
          * @brief Copy constructor
+         *
+         * The copy of a tile that belongs to a Grid is placed at the
+         * current position of the tile but it does not belong to the
+         * grid, so it does not follow the grid when the grid moves
          */
         Tile(const Tile&);
 
         /**
          * @brief Copy assignment operator
+         *
+         * @see Tile(const Tile&)
          */
         Tile& operator=(Tile);
 
@@ -87,6 +93,10 @@ namespace mighter2d {
         /**
          * @brief Get the position of the tile
          * @return The position of the tile
+         *
+         * The position of a tile that belongs to a Grid is derived from
+         * the position of the grid, so it follows the grid without the
+         * tile emitting a position change event
          */
         Vector2f getPosition() const;
 
@@ -224,10 +234,24 @@ namespace mighter2d {
         ~Tile() override;
 
     private:
-        char id_;               //!< Tile id
-        Index index_;           //!< Position of the tile in the grid
-        RectangleShape tile_;   //!< Tile
-        bool isCollidable_;     //!< A flag indicating whether or not the tile is collidable
+        /**
+         * @brief Make the position of the tile relative to a grid
+         * @param gridPosition The position of the grid the tile belongs to
+         * @param offset The position of the tile relative to the grid
+         *
+         * The grid must outlive the tile
+         */
+        void setGridPosition(const Vector2f* gridPosition, Vector2f offset);
+
+    private:
+        char id_;                      //!< Tile id
+        Index index_;                  //!< Position of the tile in the grid
+        RectangleShape tile_;          //!< Tile
+        bool isCollidable_;            //!< A flag indicating whether or not the tile is collidable
+        const Vector2f* gridPosition_; //!< The position of the grid the tile belongs to or a nullptr if it does not belong to a grid
+        Vector2f gridOffset_;          //!< The position of the tile relative to the grid
+
+        friend class Grid;
     };
 }
 
@@ -0,0 +1,320 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_TILEMAP_H
+#define MIGHTER2D_TILEMAP_H
+
+#include "Mighter2d/Config.h"
+#include "Mighter2d/common/Vector2.h"
+#include "Mighter2d/core/grid/Index.h"
+#include "Mighter2d/graphics/Drawable.h"
+#include "Mighter2d/graphics/SpriteSheet.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mighter2d {
+    class Scene;
+
+    /// @internal
+    namespace priv {
+        class TileMapLayer;
+    }
+
+    /**
+     * @brief A multi-layer map of tiles whose images come from a tileset
+     *
+     * The tileset is a SpriteSheet and each tile refers to one of its frames
+     * by number. Frames are numbered from 0 in row-major order, and a tile
+     * with the value EMPTY_TILE (or any value that is not the number of a
+     * frame in the tileset) is not drawn. All the layers have the same size
+     * and the same tileset, and they are drawn in the order they were added,
+     * so the first layer is at the bottom.
+     *
+     * Unlike a Sprite per tile, each layer is drawn in chunks of tiles with
+     * one draw call per chunk, and only the chunks in view are drawn. This
+     * makes the tilemap suitable for maps with a large number of tiles.
+     *
+     * The tilemap can be imported from CSV files (one layer per file) and
+     * from orthogonal Tiled TMX maps
+     */
+    class MIGHTER2D_API TileMap : public Drawable {
+    public:
+        using Ptr = std::unique_ptr<TileMap>; //!< Unique tilemap pointer
+
+        static constexpr int EMPTY_TILE = -1; //!< The value of a tile that has no image
+
+        /**
+         * @brief Constructor
+         * @param scene The scene the tilemap belongs to
+         *
+         * This constructor creates an empty tilemap. Call create(),
+         * loadFromCSV() or loadFromTMX() to give it a size and a tileset
+         */
+        explicit TileMap(Scene& scene);
+
+        /**
+         * @brief Create a tilemap
+         * @param scene The scene the tilemap belongs to
+         * @return The created tilemap
+         */
+        static TileMap::Ptr create(Scene& scene);
+
+        /**
+         * @brief Get the name of this class
+         * @return The name of this class
+         */
+        std::string getClassName() const override;
+
+        /**
+         * @brief Give the tilemap a tileset and a size
+         * @param tileset The tileset the tiles refer to
+         * @param rows The number of rows of tiles
+         * @param colms The number of columns of tiles
+         *
+         * All existing layers are removed
+         *
+         * @see addLayer
+         */
+        void create(const SpriteSheet& tileset, unsigned int rows, unsigned int colms);
+
+        /**
+         * @brief Change the tileset
+         * @param tileset The new tileset
+         *
+         * The tiles keep their frame numbers, which now refer to the frames
+         * of the new tileset. The size of each tile is the frame size of
+         * the tileset
+         */
+        void setTileset(const SpriteSheet& tileset);
+
+        /**
+         * @brief Get the tileset
+         * @return The tileset
+         */
+        const SpriteSheet& getTileset() const;
+
+        /**
+         * @brief Get the size of each tile
+         * @return The size of each tile in pixels
+         */
+        Vector2u getTileSize() const;
+
+        /**
+         * @brief Get the number of rows of tiles
+         * @return The number of rows of tiles
+         */
+        unsigned int getRowCount() const;
+
+        /**
+         * @brief Get the number of columns of tiles
+         * @return The number of columns of tiles
+         */
+        unsigned int getColumnCount() const;
+
+        /**
+         * @brief Set the position of the tilemap
+         * @param x The x coordinate of the new position
+         * @param y The y coordinate of the new position
+         *
+         * The position is the top-left corner of the first tile. By
+         * default, the position is (0, 0)
+         */
+        void setPosition(float x, float y);
+
+        /**
+         * @brief Set the position of the tilemap
+         * @param position The new position
+         */
+        void setPosition(const Vector2f& position);
+
+        /**
+         * @brief Get the position of the tilemap
+         * @return The position of the tilemap
+         */
+        Vector2f getPosition() const;
+
+        /**
+         * @brief Add a layer on top of the existing layers
+         * @param name The name of the layer
+         * @return True if the layer was added or false if the tilemap already
+         *         has a layer with the same name
+         *
+         * All the tiles of the new layer are empty
+         */
+        bool addLayer(const std::string& name);
+
+        /**
+         * @brief Remove a layer
+         * @param name The name of the layer to be removed
+         * @return True if the layer was removed or false if there is no
+         *         layer with the given name
+         */
+        bool removeLayer(const std::string& name);
+
+        /**
+         * @brief Check if the tilemap has a layer or not
+         * @param name The name of the layer to be checked
+         * @return True if the tilemap has the layer, otherwise false
+         */
+        bool hasLayer(const std::string& name) const;
+
+        /**
+         * @brief Get the number of layers
+         * @return The number of layers
+         */
+        std::size_t getLayerCount() const;
+
+        /**
+         * @brief Get the names of the layers
+         * @return The names of the layers from the bottom layer to the top layer
+         */
+        std::vector<std::string> getLayerNames() const;
+
+        /**
+         * @brief Show or hide a layer
+         * @param name The name of the layer
+         * @param visible True to show the layer or false to hide it
+         * @throws InvalidArgumentException If there is no layer with the
+         *         given name
+         */
+        void setLayerVisible(const std::string& name, bool visible);
+
+        /**
+         * @brief Check if a layer is visible or not
+         * @param name The name of the layer
+         * @return True if the layer is visible, otherwise false
+         * @throws InvalidArgumentException If there is no layer with the
+         *         given name
+         */
+        bool isLayerVisible(const std::string& name) const;
+
+        /**
+         * @brief Set the tile at an index of a layer
+         * @param layer The name of the layer
+         * @param index The index of the tile
+         * @param tile The frame number of the tile or EMPTY_TILE
+         * @throws InvalidArgumentException If there is no layer with the
+         *         given name
+         *
+         * This function has no effect if @a index is out of bounds
+         */
+        void setTile(const std::string& layer, const Index& index, int tile);
+
+        /**
+         * @brief Get the tile at an index of a layer
+         * @param layer The name of the layer
+         * @param index The index of the tile
+         * @return The frame number of the tile or EMPTY_TILE if @a index
+         *         is out of bounds
+         * @throws InvalidArgumentException If there is no layer with the
+         *         given name
+         */
+        int getTile(const std::string& layer, const Index& index) const;
+
+        /**
+         * @brief Set all the tiles of a layer to the same frame
+         * @param layer The name of the layer
+         * @param tile The frame number of the tiles or EMPTY_TILE
+         * @throws InvalidArgumentException If there is no layer with the
+         *         given name
+         */
+        void fill(const std::string& layer, int tile);
+
+        /**
+         * @brief Load a layer from a CSV file
+         * @param filename The name of the CSV file
+         * @param layer The name of the layer to load the tiles into
+         * @throws FileNotFoundException If @a filename cannot be opened
+         * @throws InvalidParseException If the file contains a value that is
+         *         not an integer, or if the number of rows or columns does
+         *         not match the size of the tilemap
+         *
+         * Each line of the file is a row of frame numbers separated by
+         * commas, as exported by Tiled, and empty lines are skipped. The
+         * layer is added if it does not exist. If the tilemap has no
+         * layers, it takes the size of the file. A tileset must be set
+         * separately
+         */
+        void loadFromCSV(const std::string& filename, const std::string& layer);
+
+        /**
+         * @brief Load the tilemap from a Tiled TMX file
+         * @param filename The name of the TMX file
+         * @throws FileNotFoundException If @a filename, an external tileset
+         *         or the tileset image cannot be found
+         * @throws InvalidParseException If the file is not a valid TMX
+         *         file or uses features that are not supported
+         *
+         * All existing layers are replaced by the tile layers of the map.
+         * The tileset is created from the image of the tileset of the map,
+         * whose path is relative to the TMX file. Only orthogonal, finite
+         * maps with a single tileset and CSV or XML tile data are supported.
+         * Flipped tiles are drawn without flipping, and object layers,
+         * image layers, groups and layer offsets are ignored
+         */
+        void loadFromTMX(const std::string& filename);
+
+        /**
+         * @internal
+         * @brief Draw the visible layers on a render target
+         * @param renderTarget The target to draw the layers on
+         *
+         * @warning This function is intended for internal use only and
+         * should never be called outside of Mighter2d
+         */
+        void draw(priv::RenderTarget& renderTarget) const override;
+
+        /**
+         * @brief Destructor
+         */
+        ~TileMap() override;
+
+    private:
+        /**
+         * @brief Get a layer by its name
+         * @param name The name of the layer
+         * @return The layer with the given name
+         * @throws InvalidArgumentException If there is no layer with the
+         *         given name
+         */
+        priv::TileMapLayer& getLayer(const std::string& name) const;
+
+        /**
+         * @brief Remove all the layers and set the size of the tilemap
+         * @param rows The number of rows of tiles
+         * @param colms The number of columns of tiles
+         */
+        void reset(unsigned int rows, unsigned int colms);
+
+    private:
+        SpriteSheet tileset_;                                     //!< The images of the tiles
+        unsigned int rows_;                                       //!< The number of rows of tiles
+        unsigned int colms_;                                      //!< The number of columns of tiles
+        Vector2f position_;                                       //!< The position of the top-left corner of the tilemap
+        std::vector<std::unique_ptr<priv::TileMapLayer>> layers_; //!< The layers from bottom to top
+    };
+}
+
+#endif // MIGHTER2D_TILEMAP_H
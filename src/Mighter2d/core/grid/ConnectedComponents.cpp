@@ -0,0 +1,283 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/grid/ConnectedComponents.h"
+#include "Mighter2d/core/grid/Grid.h"
+#include <algorithm>
+#include <limits>
+
+namespace mighter2d::priv {
+    namespace {
+        constexpr auto NO_NODE = std::numeric_limits<std::size_t>::max();
+    }
+
+    ConnectedComponents::ConnectedComponents() :
+        rows_{0},
+        colms_{0},
+        gridId_{0},
+        version_{0},
+        searchId_{0}
+    {}
+
+    bool ConnectedComponents::isReachable(const Grid &grid, const Index &sourceTile, const Index &targetTile) {
+        if (!grid.isIndexValid(sourceTile) || !grid.isIndexValid(targetTile))
+            return false;
+
+        update(grid);
+
+        const std::size_t target = static_cast<std::size_t>(targetTile.row) * colms_ + static_cast<std::size_t>(targetTile.colm);
+        if (!accessible_[target])
+            return false;
+
+        const std::size_t root = findRoot(nodes_[target]);
+        const std::size_t source = static_cast<std::size_t>(sourceTile.row) * colms_ + static_cast<std::size_t>(sourceTile.colm);
+        if (accessible_[source])
+            return findRoot(nodes_[source]) == root;
+
+        std::array<std::size_t, 4> neighbours{};
+        std::size_t count = getNeighbours(source, neighbours);
+        for (std::size_t i = 0; i < count; i++) {
+            if (findRoot(nodes_[neighbours[i]]) == root)
+                return true;
+        }
+
+        return false;
+    }
+
+    void ConnectedComponents::update(const Grid &grid) {
+        const Vector2u size = grid.getSizeInTiles();
+
+        if (grid.getObjectId() != gridId_ || size.x != colms_ || size.y != rows_ || accessible_.empty()) {
+            rebuild(grid);
+            return;
+        }
+
+        if (grid.getVersion() == version_)
+            return;
+
+        // Every addition and split creates a node, start afresh once the forest is mostly garbage
+        if (parents_.size() > 2 * accessible_.size() || !grid.getChangedTiles(version_, changedTiles_)) {
+            rebuild(grid);
+            return;
+        }
+
+        for (const auto& index : changedTiles_) {
+            const std::size_t tile = static_cast<std::size_t>(index.row) * colms_ + static_cast<std::size_t>(index.colm);
+            const bool isNowAccessible = grid.isTileAccessible(index);
+
+            // A tile appears in the log once per change, its state may not have changed overall
+            if (static_cast<bool>(accessible_[tile]) == isNowAccessible)
+                continue;
+
+            accessible_[tile] = isNowAccessible;
+
+            if (isNowAccessible)
+                addTile(tile);
+            else
+                removeTile(tile);
+        }
+
+        version_ = grid.getVersion();
+    }
+
+    void ConnectedComponents::rebuild(const Grid &grid) {
+        gridId_ = grid.getObjectId();
+        version_ = grid.getVersion();
+        colms_ = grid.getSizeInTiles().x;
+        rows_ = grid.getSizeInTiles().y;
+
+        const std::size_t tileCount = rows_ * colms_;
+        accessible_.resize(tileCount);
+        for (std::size_t tile = 0; tile < tileCount; tile++)
+            accessible_[tile] = grid.isTileAccessible(Index{static_cast<int>(tile / colms_), static_cast<int>(tile % colms_)});
+
+        nodes_.assign(tileCount, NO_NODE);
+        parents_.clear();
+        ranks_.clear();
+        visitedIn_.assign(tileCount, 0u);
+        visitedBy_.resize(tileCount);
+        searchId_ = 0;
+
+        // Flood fill each component, all its tiles share a single node
+        std::vector<std::size_t> tilesToVisit;
+        std::array<std::size_t, 4> neighbours{};
+        for (std::size_t tile = 0; tile < tileCount; tile++) {
+            if (!accessible_[tile] || nodes_[tile] != NO_NODE)
+                continue;
+
+            const std::size_t node = createNode();
+            nodes_[tile] = node;
+            tilesToVisit.push_back(tile);
+
+            while (!tilesToVisit.empty()) {
+                std::size_t current = tilesToVisit.back();
+                tilesToVisit.pop_back();
+
+                std::size_t count = getNeighbours(current, neighbours);
+                for (std::size_t i = 0; i < count; i++) {
+                    if (nodes_[neighbours[i]] == NO_NODE) {
+                        nodes_[neighbours[i]] = node;
+                        tilesToVisit.push_back(neighbours[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    void ConnectedComponents::addTile(std::size_t tile) {
+        // The old node of the tile may still be an inner node of a tree, so it cannot be reused
+        nodes_[tile] = createNode();
+
+        std::array<std::size_t, 4> neighbours{};
+        std::size_t count = getNeighbours(tile, neighbours);
+        for (std::size_t i = 0; i < count; i++)
+            unite(nodes_[tile], nodes_[neighbours[i]]);
+    }
+
+    void ConnectedComponents::removeTile(std::size_t tile) {
+        std::array<std::size_t, 4> neighbours{};
+        std::size_t count = getNeighbours(tile, neighbours);
+        if (count < 2)
+            return;
+
+        if (++searchId_ == 0) {
+            std::fill(visitedIn_.begin(), visitedIn_.end(), 0u);
+            searchId_ = 1;
+        }
+
+        regions_.resize(count);
+        for (std::size_t i = 0; i < count; i++) {
+            regions_[i].tiles.assign(1, neighbours[i]);
+            regions_[i].head = 0;
+            regions_[i].owner = i;
+            visitedIn_[neighbours[i]] = searchId_;
+            visitedBy_[neighbours[i]] = i;
+        }
+
+        // Expand one tile of each searching region in turn. When two regions meet, they are on the same
+        // side of the removed tile and continue as one. The last region searching keeps the old component
+        std::size_t searchingCount = count;
+        std::array<std::size_t, 4> expandedNeighbours{};
+        while (searchingCount > 1) {
+            for (std::size_t i = 0; i < count && searchingCount > 1; i++) {
+                Region& region = regions_[i];
+                if (region.owner != i || region.head == region.tiles.size())
+                    continue;
+
+                const std::size_t current = region.tiles[region.head++];
+                const std::size_t neighbourCount = getNeighbours(current, expandedNeighbours);
+                bool isMerged = false;
+
+                for (std::size_t n = 0; n < neighbourCount && !isMerged; n++) {
+                    const std::size_t neighbour = expandedNeighbours[n];
+                    if (visitedIn_[neighbour] != searchId_) {
+                        visitedIn_[neighbour] = searchId_;
+                        visitedBy_[neighbour] = i;
+                        region.tiles.push_back(neighbour);
+                    } else if (std::size_t owner = getOwner(visitedBy_[neighbour]); owner != i) {
+                        // The rest of the neighbours of the current tile are not visited yet, so it must be expanded again.
+                        // The expanded tiles of both regions are kept in front of the tiles still to be expanded
+                        region.head--;
+                        Region& into = regions_[owner];
+                        into.tiles.insert(into.tiles.begin() + static_cast<std::ptrdiff_t>(into.head),
+                            region.tiles.begin(), region.tiles.begin() + static_cast<std::ptrdiff_t>(region.head));
+                        into.tiles.insert(into.tiles.end(), region.tiles.begin() + static_cast<std::ptrdiff_t>(region.head), region.tiles.end());
+                        into.head += region.head;
+                        region.tiles.clear();
+                        region.head = 0;
+                        region.owner = owner;
+                        searchingCount--;
+                        isMerged = true;
+                    }
+                }
+
+                if (!isMerged && region.head == region.tiles.size()) {
+                    // Nothing else is reachable from this region, it is a component of its own
+                    const std::size_t node = createNode();
+                    for (auto regionTile : region.tiles)
+                        nodes_[regionTile] = node;
+
+                    searchingCount--;
+                }
+            }
+        }
+    }
+
+    std::size_t ConnectedComponents::getNeighbours(std::size_t tile, std::array<std::size_t, 4>& neighbours) const {
+        const std::size_t row = tile / colms_;
+        const std::size_t colm = tile % colms_;
+        std::size_t count = 0;
+
+        if (colm > 0 && accessible_[tile - 1])
+            neighbours[count++] = tile - 1;
+
+        if (row > 0 && accessible_[tile - colms_])
+            neighbours[count++] = tile - colms_;
+
+        if (colm + 1 < colms_ && accessible_[tile + 1])
+            neighbours[count++] = tile + 1;
+
+        if (row + 1 < rows_ && accessible_[tile + colms_])
+            neighbours[count++] = tile + colms_;
+
+        return count;
+    }
+
+    std::size_t ConnectedComponents::getOwner(std::size_t region) const {
+        while (regions_[region].owner != region)
+            region = regions_[region].owner;
+
+        return region;
+    }
+
+    std::size_t ConnectedComponents::findRoot(std::size_t node) {
+        // Path halving, every other node on the way is pointed at its grandparent
+        while (parents_[node] != node) {
+            parents_[node] = parents_[parents_[node]];
+            node = parents_[node];
+        }
+
+        return node;
+    }
+
+    void ConnectedComponents::unite(std::size_t lhs, std::size_t rhs) {
+        lhs = findRoot(lhs);
+        rhs = findRoot(rhs);
+        if (lhs == rhs)
+            return;
+
+        if (ranks_[lhs] < ranks_[rhs])
+            std::swap(lhs, rhs);
+
+        parents_[rhs] = lhs;
+        if (ranks_[lhs] == ranks_[rhs])
+            ranks_[lhs]++;
+    }
+
+    std::size_t ConnectedComponents::createNode() {
+        parents_.push_back(parents_.size());
+        ranks_.push_back(0);
+        return parents_.size() - 1;
+    }
+}
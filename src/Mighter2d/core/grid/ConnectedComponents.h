@@ -0,0 +1,166 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_CONNECTEDCOMPONENTS_H
+#define MIGHTER2D_CONNECTEDCOMPONENTS_H
+
+#include "Mighter2d/Config.h"
+#include "Mighter2d/core/grid/Index.h"
+#include <array>
+#include <vector>
+
+namespace mighter2d {
+    class Grid;
+}
+
+namespace mighter2d::priv {
+    /**
+     * @brief Labels the groups of tiles of a Grid that are reachable from each other
+     *
+     * A tile can be entered if it is not collidable and does not contain
+     * an active obstacle. Two tiles that can be entered are in the same
+     * component if a path of horizontal and vertical moves connects them.
+     * Since a diagonal move is only allowed when both tiles beside it can
+     * be entered, diagonal moves never connect different components.
+     *
+     * The components are stored in a union-find forest. Each tile refers
+     * to a node and the tiles whose nodes have the same root are in the
+     * same component. The forest is updated from the change log of the
+     * grid (see Grid::getChangedTiles). A tile that can now be entered
+     * joins the components of its neighbours. When a tile can no longer
+     * be entered, its neighbours are searched in turn, one tile each,
+     * until all but one of the searches either met another search or
+     * ran out of tiles. The tiles of a search that ran out of tiles are
+     * split off into a new component. The cost is therefore bounded by
+     * the size of the smaller parts, and it is only a few tiles when the
+     * neighbours are still connected around the tile
+     */
+    class ConnectedComponents {
+    public:
+        /**
+         * @brief Constructor
+         */
+        ConnectedComponents();
+
+        /**
+         * @brief Check whether or not a tile can be reached from another tile
+         * @param grid The grid the tiles are in
+         * @param sourceTile The tile to start from
+         * @param targetTile The tile to be reached
+         * @return True if @a targetTile can be entered and is in the same
+         *         component as @a sourceTile or one of its neighbours
+         *
+         * The source tile is not required to be enterable, since it is
+         * usually the tile of the object looking for a path. The labels
+         * are brought up to date with the grid first
+         */
+        bool isReachable(const Grid& grid, const Index& sourceTile, const Index& targetTile);
+
+    private:
+        /**
+         * @brief A search started from a neighbour of a tile that can no longer be entered
+         */
+        struct Region {
+            std::vector<std::size_t> tiles; //!< The tiles reached by the search, the expanded tiles first
+            std::size_t head;               //!< The position of the next tile to be expanded
+            std::size_t owner;              //!< The region this region was merged into, or its own position
+        };
+
+        /**
+         * @brief Bring the labels up to date with the grid
+         * @param grid The grid the labels are for
+         */
+        void update(const Grid& grid);
+
+        /**
+         * @brief Label all the tiles of the grid
+         * @param grid The grid the labels are for
+         */
+        void rebuild(const Grid& grid);
+
+        /**
+         * @brief Update the labels after a tile can be entered
+         * @param tile Row-major position of the tile
+         */
+        void addTile(std::size_t tile);
+
+        /**
+         * @brief Update the labels after a tile can no longer be entered
+         * @param tile Row-major position of the tile
+         */
+        void removeTile(std::size_t tile);
+
+        /**
+         * @brief Get the neighbours of a tile that can be entered
+         * @param tile Row-major position of the tile
+         * @param neighbours Filled with the row-major position of the neighbours
+         * @return The number of neighbours that can be entered
+         */
+        std::size_t getNeighbours(std::size_t tile, std::array<std::size_t, 4>& neighbours) const;
+
+        /**
+         * @brief Get the region a region was merged into
+         * @param region The position of the region
+         * @return The position of the region that is still searching for @a region
+         */
+        std::size_t getOwner(std::size_t region) const;
+
+        /**
+         * @brief Get the root of the tree of a node
+         * @param node The node to get the root of
+         * @return The root of the tree containing @a node
+         */
+        std::size_t findRoot(std::size_t node);
+
+        /**
+         * @brief Merge the trees of two nodes
+         * @param lhs A node of the first tree
+         * @param rhs A node of the second tree
+         */
+        void unite(std::size_t lhs, std::size_t rhs);
+
+        /**
+         * @brief Create a node that is the root of its own tree
+         * @return The created node
+         */
+        std::size_t createNode();
+
+    private:
+        std::size_t rows_;                       //!< The number of rows in the grid
+        std::size_t colms_;                      //!< The number of columns in the grid
+        unsigned int gridId_;                    //!< The object id of the grid the labels are for
+        Uint64 version_;                         //!< The version of the grid the labels are for
+        std::vector<unsigned char> accessible_;  //!< Whether or not each tile can be entered
+        std::vector<std::size_t> nodes_;         //!< The node of each tile that can be entered
+        std::vector<std::size_t> parents_;       //!< The parent of each node, a root is its own parent
+        std::vector<unsigned char> ranks_;       //!< The upper bound of the height of the tree of each root
+        std::vector<unsigned int> visitedIn_;    //!< The search in which each tile was last reached
+        std::vector<std::size_t> visitedBy_;     //!< The region that reached each tile first
+        std::vector<Region> regions_;            //!< The searches started from the neighbours of a removed tile
+        std::vector<Index> changedTiles_;        //!< The tiles modified since the labels were updated
+        unsigned int searchId_;                  //!< Identifies the current search, so visitedIn_ need not be cleared
+    };
+}
+
+#endif // MIGHTER2D_CONNECTEDCOMPONENTS_H
@@ -0,0 +1,275 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/grid/FlowField.h"
+#include "Mighter2d/core/grid/Grid.h"
+#include <algorithm>
+#include <limits>
+
+namespace mighter2d {
+    namespace {
+        constexpr float UNREACHABLE = std::numeric_limits<float>::max();
+
+        // Moves in the order W, N, E, S
+        constexpr int ROW_OFFSETS[] = {0, -1, 0, 1};
+        constexpr int COLM_OFFSETS[] = {-1, 0, 1, 0};
+    }
+
+    FlowField::FlowField(const Grid &grid, const Index &destination) :
+        grid_{grid},
+        destination_{destination},
+        rows_{0},
+        colms_{0},
+        version_{0},
+        isBuilt_{false}
+    {
+        update();
+    }
+
+    const Index& FlowField::getDestination() const {
+        return destination_;
+    }
+
+    void FlowField::update() {
+        if (!isBuilt_ || rows_ != static_cast<int>(grid_.getSizeInTiles().y) || colms_ != static_cast<int>(grid_.getSizeInTiles().x))
+            rebuild();
+        else if (version_ != grid_.getVersion()) {
+            if (grid_.getChangedTiles(version_, changedTiles_))
+                repair(changedTiles_);
+            else
+                rebuild();
+        }
+
+        version_ = grid_.getVersion();
+    }
+
+    Index FlowField::getNextTile(const Index &index) const {
+        const std::size_t tile = getTile(index);
+        const std::size_t destination = getTile(destination_);
+        std::size_t next = costs_.size();
+
+        if (tile == costs_.size() || tile == destination)
+            return Index{-1, -1};
+        else if (isAccessible(tile))
+            next = nextTiles_[tile];
+        else
+            findCheapestNeighbour(tile, next);
+
+        if (next == costs_.size())
+            return Index{-1, -1};
+
+        return Index{static_cast<int>(next / static_cast<std::size_t>(colms_)), static_cast<int>(next % static_cast<std::size_t>(colms_))};
+    }
+
+    float FlowField::getCost(const Index &index) const {
+        const std::size_t tile = getTile(index);
+        if (tile == costs_.size())
+            return -1.0f;
+
+        std::size_t next;
+        float cost = isAccessible(tile) ? costs_[tile] : findCheapestNeighbour(tile, next);
+        return cost == UNREACHABLE ? -1.0f : cost;
+    }
+
+    bool FlowField::isReachable(const Index &index) const {
+        return getCost(index) >= 0.0f;
+    }
+
+    void FlowField::rebuild() {
+        isBuilt_ = true;
+        rows_ = static_cast<int>(grid_.getSizeInTiles().y);
+        colms_ = static_cast<int>(grid_.getSizeInTiles().x);
+
+        const std::size_t tileCount = static_cast<std::size_t>(rows_) * static_cast<std::size_t>(colms_);
+        costs_.assign(tileCount, UNREACHABLE);
+        nextTiles_.assign(tileCount, tileCount);
+        moveCosts_.resize(tileCount);
+        accessible_.resize(tileCount);
+
+        for (int row = 0; row < rows_; ++row) {
+            for (int colm = 0; colm < colms_; ++colm) {
+                const std::size_t tile = static_cast<std::size_t>(row) * static_cast<std::size_t>(colms_) + static_cast<std::size_t>(colm);
+                accessible_[tile] = grid_.isTileAccessible(Index{row, colm});
+                moveCosts_[tile] = grid_.getMovementCost(Index{row, colm});
+            }
+        }
+
+        openSet_.clear();
+        const std::size_t destination = getTile(destination_);
+        if (destination != tileCount && accessible_[destination]) {
+            costs_[destination] = 0.0f;
+            openSet_.push_back({0.0f, destination});
+        }
+
+        propagate();
+    }
+
+    void FlowField::repair(const std::vector<Index>& changedTiles) {
+        const std::size_t tileCount = costs_.size();
+        const std::size_t destination = getTile(destination_);
+        std::vector<std::size_t> invalidatedTiles;
+        std::vector<std::size_t> freedTiles;
+        std::vector<std::size_t> tilesToVisit;
+
+        for (const auto& index : changedTiles) {
+            const std::size_t tile = getTile(index);
+            if (tile == tileCount)
+                continue;
+
+            const bool isNowAccessible = grid_.isTileAccessible(index);
+            if (static_cast<bool>(accessible_[tile]) == isNowAccessible)
+                continue;
+
+            accessible_[tile] = isNowAccessible;
+
+            if (isNowAccessible) {
+                freedTiles.push_back(tile);
+                continue;
+            } else if (costs_[tile] == UNREACHABLE)
+                continue;
+
+            // The tiles that reached the destination through the blocked tile must find another way
+            tilesToVisit.push_back(tile);
+            while (!tilesToVisit.empty()) {
+                const std::size_t current = tilesToVisit.back();
+                tilesToVisit.pop_back();
+                costs_[current] = UNREACHABLE;
+                nextTiles_[current] = tileCount;
+                invalidatedTiles.push_back(current);
+
+                const int row = static_cast<int>(current / static_cast<std::size_t>(colms_));
+                const int colm = static_cast<int>(current % static_cast<std::size_t>(colms_));
+                for (int move = 0; move < 4; ++move) {
+                    const std::size_t neighbour = getTile(Index{row + ROW_OFFSETS[move], colm + COLM_OFFSETS[move]});
+                    if (neighbour != tileCount && costs_[neighbour] != UNREACHABLE && nextTiles_[neighbour] == current)
+                        tilesToVisit.push_back(neighbour);
+                }
+            }
+        }
+
+        // Restart the invalidated tiles from the neighbours whose costs are still valid
+        openSet_.clear();
+        std::vector<std::size_t> nextTiles;
+        for (auto tile : invalidatedTiles) {
+            std::size_t next;
+            if (isAccessible(tile)) {
+                float cost = findCheapestNeighbour(tile, next);
+                if (cost != UNREACHABLE) {
+                    openSet_.push_back({cost, tile});
+                    nextTiles.push_back(next);
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i < openSet_.size(); ++i) {
+            costs_[openSet_[i].tile] = openSet_[i].cost;
+            nextTiles_[openSet_[i].tile] = nextTiles[i];
+        }
+
+        for (auto tile : freedTiles) {
+            if (tile == destination) {
+                costs_[tile] = 0.0f;
+                nextTiles_[tile] = tileCount;
+                openSet_.push_back({0.0f, tile});
+            } else {
+                std::size_t next;
+                float cost = findCheapestNeighbour(tile, next);
+                if (cost < costs_[tile]) {
+                    costs_[tile] = cost;
+                    nextTiles_[tile] = next;
+                    openSet_.push_back({cost, tile});
+                }
+            }
+        }
+
+        auto isCheaper = [](const OpenNode& lhs, const OpenNode& rhs) {
+            return lhs.cost > rhs.cost;
+        };
+
+        std::make_heap(openSet_.begin(), openSet_.end(), isCheaper);
+        propagate();
+    }
+
+    float FlowField::findCheapestNeighbour(std::size_t tile, std::size_t &next) const {
+        const int row = static_cast<int>(tile / static_cast<std::size_t>(colms_));
+        const int colm = static_cast<int>(tile % static_cast<std::size_t>(colms_));
+        float cheapestCost = UNREACHABLE;
+        next = costs_.size();
+
+        for (int move = 0; move < 4; ++move) {
+            const std::size_t neighbour = getTile(Index{row + ROW_OFFSETS[move], colm + COLM_OFFSETS[move]});
+            if (neighbour == costs_.size() || !accessible_[neighbour] || costs_[neighbour] == UNREACHABLE)
+                continue;
+
+            const float cost = costs_[neighbour] + moveCosts_[neighbour];
+            if (cost < cheapestCost) {
+                cheapestCost = cost;
+                next = neighbour;
+            }
+        }
+
+        return cheapestCost;
+    }
+
+    void FlowField::propagate() {
+        auto isCheaper = [](const OpenNode& lhs, const OpenNode& rhs) {
+            return lhs.cost > rhs.cost;
+        };
+
+        while (!openSet_.empty()) {
+            std::pop_heap(openSet_.begin(), openSet_.end(), isCheaper);
+            OpenNode current = openSet_.back();
+            openSet_.pop_back();
+
+            // A tile is pushed again when a cheaper way to the destination is found, skip the outdated entries
+            if (current.cost > costs_[current.tile])
+                continue;
+
+            const int row = static_cast<int>(current.tile / static_cast<std::size_t>(colms_));
+            const int colm = static_cast<int>(current.tile % static_cast<std::size_t>(colms_));
+            const float cost = current.cost + moveCosts_[current.tile];
+
+            for (int move = 0; move < 4; ++move) {
+                const std::size_t neighbour = getTile(Index{row + ROW_OFFSETS[move], colm + COLM_OFFSETS[move]});
+                if (neighbour != costs_.size() && accessible_[neighbour] && cost < costs_[neighbour]) {
+                    costs_[neighbour] = cost;
+                    nextTiles_[neighbour] = current.tile;
+                    openSet_.push_back({cost, neighbour});
+                    std::push_heap(openSet_.begin(), openSet_.end(), isCheaper);
+                }
+            }
+        }
+    }
+
+    bool FlowField::isAccessible(std::size_t tile) const {
+        return accessible_[tile];
+    }
+
+    std::size_t FlowField::getTile(const Index &index) const {
+        if (index.row < 0 || index.row >= rows_ || index.colm < 0 || index.colm >= colms_)
+            return costs_.size();
+
+        return static_cast<std::size_t>(index.row) * static_cast<std::size_t>(colms_) + static_cast<std::size_t>(index.colm);
+    }
+}
@@ -23,19 +23,59 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Mighter2d/core/grid/Grid.h"
+#include "Mighter2d/core/grid/ConnectedComponents.h"
+#include "Mighter2d/core/grid/FlowField.h"
+#include "Mighter2d/core/grid/GridChunkRenderer.h"
 #include "Mighter2d/core/grid/GridParser.h"
+#include "Mighter2d/core/grid/TileStorage.h"
 #include "Mighter2d/core/resources/ResourceManager.h"
 #include "Mighter2d/core/object/GridObject.h"
+#include "Mighter2d/core/scene/RenderLayer.h"
+#include "Mighter2d/core/scene/Scene.h"
 #include "Mighter2d/graphics/RenderTarget.h"
 #include <algorithm>
+#include <cmath>
 
 namespace mighter2d {
-    bool isInTile(GridObject* child, const Tile& tile) {
-        if (child) {
-            return tile.contains(child->getTransform().getPosition());
+    namespace {
+        // The maximum number of tiles recorded by the change log
+        constexpr std::size_t MAX_CHANGE_LOG_SIZE = 4096;
+
+        // Index of the tile spanning a coordinate along one axis of the grid, or -1 if there is none
+        int getTileIndex(float coordinate, float tileSize, float tileSpacing, unsigned int tileCount) {
+            if (tileCount == 0 || !(coordinate >= 0.0f))
+                return -1;
+
+            const float pitch = tileSize + tileSpacing;
+            auto index = static_cast<long long>(std::floor(coordinate / pitch));
+            float offset = coordinate - static_cast<float>(index) * pitch;
+
+            // Guard against the rounding of the division
+            if (offset < 0.0f) {
+                index--;
+                offset += pitch;
+            } else if (offset >= pitch) {
+                index++;
+                offset -= pitch;
+            }
+
+            // Tiles include their far edge, so without spacing a shared edge belongs to the first tile
+            if (offset == 0.0f && tileSpacing == 0.0f && index > 0)
+                index--;
+            else if (offset > tileSize)
+                return -1; // In the space between two tiles
+
+            if (index >= static_cast<long long>(tileCount))
+                return -1;
+
+            return static_cast<int>(index);
         }
 
-        return false;
+        // Stops a drawable that is drawn by the grid from also being drawn by its render layer
+        void removeFromRenderLayer(Scene& scene, Drawable& drawable) {
+            if (auto renderLayer = scene.getRenderLayers().findByName(drawable.getRenderLayer()))
+                renderLayer->remove(drawable);
+        }
     }
 
     Grid::Grid(unsigned int tileWidth, unsigned int tileHeight, Scene& scene) :
@@ -43,8 +83,14 @@ namespace mighter2d {
         scene_{scene},
         tileSpacing_{1u},
         invalidTile_(scene, {0, 0}, {-1, -1}),
-        backgroundTile_(scene)
+        backgroundTile_(scene),
+        tileStorage_{std::make_unique<priv::TileStorage>()},
+        streamingRadius_{1u},
+        version_{0},
+        changeLogVersion_{0},
+        components_{std::make_unique<priv::ConnectedComponents>()}
     {
+        movementCosts_.fill(1.0f);
         invalidTile_.setIndex({-1, -1});
         invalidTile_.setVisible(false);
 
@@ -57,8 +103,12 @@ namespace mighter2d {
             tileHeight = 8;
 
         tileSize_ = Vector2u{tileWidth, tileHeight};
+        chunkRenderer_ = std::make_unique<priv::GridChunkRenderer>(tileSize_, tileSpacing_);
+        chunkRenderer_->setColours(renderer_.getTileColour(), renderer_.getCollidableTileColour());
 
+        // The background is drawn by the grid so that it is always behind the tiles
         backgroundTile_.setFillColour(renderer_.getGridLineColour());
+        removeFromRenderLayer(scene_, backgroundTile_);
         renderer_.onPropertyChange([this](const Property& property){
             onRenderChange(property);
         });
@@ -89,14 +139,19 @@ namespace mighter2d {
     }
 
     const Tile& Grid::getTile(const Vector2f &position) const {
-        for (auto& tileRows : tiledMap_) {
-            for (auto& tile : tileRows) {
-                if (tile.contains(position))
-                    return tile;
-            }
-        }
+        return getTile(getIndexAt(position));
+    }
+
+    Index Grid::getIndexAt(const Vector2f &position) const {
+        // The first tile is offset from the grid position by the tile spacing
+        const auto spacing = static_cast<float>(tileSpacing_);
+        int row = getTileIndex(position.y - mapPos_.y - spacing, static_cast<float>(tileSize_.y), spacing, numOfRows_);
+        int colm = getTileIndex(position.x - mapPos_.x - spacing, static_cast<float>(tileSize_.x), spacing, numOfColms_);
+
+        if (row == -1 || colm == -1)
+            return {-1, -1};
 
-        return invalidTile_;
+        return {row, colm};
     }
 
     const Tile &Grid::getTileAbove(const Tile &tile) const {
@@ -121,36 +176,100 @@ namespace mighter2d {
     }
 
     void Grid::construct(const Vector2u& size, char id) {
-        for (auto i = 0u; i < size.x; ++i) {
-            auto innerVector = std::vector<char>(size.y, id);
-            mapData_.push_back(std::move(innerVector));
-        }
-
+        createTiledMap(size.x, size.y, id);
         computeDimensions();
-        createTiledMap();
     }
 
     void Grid::loadFromFile(const std::string &filename, const char& separator) {
-        mapData_ = GridParser::parse(filename, separator);
+        // Binary map files are not parsed, their tiles are read when first accessed
+        if (GridParser::isBinary(filename)) {
+            tileStorage_->open(filename, separator, false);
+            resetTiledMap();
+        } else
+            createTiledMap(GridParser::parse(filename, separator));
+
         computeDimensions();
-        createTiledMap();
     }
 
     void Grid::loadFromVector(Map map) {
-        mapData_ = std::move(map);
+        createTiledMap(map);
+        computeDimensions();
+    }
+
+    void Grid::streamFromFile(const std::string &filename, const char &separator) {
+        tileStorage_->open(filename, separator, true);
+        resetTiledMap();
         computeDimensions();
-        createTiledMap();
+        tileStorage_->setFocusPoints(getFocusIndexes(), streamingRadius_);
+    }
+
+    void Grid::convertToBinary(const std::string &filename, const std::string &binaryFilename, const char &separator) {
+        GridParser::writeBinary(GridParser::parse(filename, separator), binaryFilename);
+    }
+
+    bool Grid::isStreamed() const {
+        return tileStorage_->isStreamed();
+    }
+
+    void Grid::setFocusPoints(const std::vector<Vector2f> &points) {
+        focusPoints_ = points;
+        tileStorage_->setFocusPoints(getFocusIndexes(), streamingRadius_);
+    }
+
+    const std::vector<Vector2f>& Grid::getFocusPoints() const {
+        return focusPoints_;
+    }
+
+    void Grid::setStreamingRadius(unsigned int radius) {
+        streamingRadius_ = radius;
+        tileStorage_->setFocusPoints(getFocusIndexes(), streamingRadius_);
+    }
+
+    unsigned int Grid::getStreamingRadius() const {
+        return streamingRadius_;
+    }
+
+    std::size_t Grid::getLoadedChunkCount() const {
+        return tileStorage_->getLoadedChunkCount();
+    }
+
+    std::vector<Index> Grid::getFocusIndexes() const {
+        // Focus points outside the grid still keep the chunks near them in memory
+        auto toTile = [](float coordinate, float tileSize, float tileSpacing) {
+            return static_cast<int>(std::floor(coordinate / (tileSize + tileSpacing)));
+        };
+
+        const auto spacing = static_cast<float>(tileSpacing_);
+        std::vector<Index> indexes;
+        indexes.reserve(focusPoints_.size());
+        for (const auto& point : focusPoints_) {
+            indexes.push_back({toTile(point.y - mapPos_.y - spacing, static_cast<float>(tileSize_.y), spacing),
+                               toTile(point.x - mapPos_.x - spacing, static_cast<float>(tileSize_.x), spacing)});
+        }
+
+        return indexes;
     }
 
     void Grid::computeDimensions() {
-        numOfRows_ = static_cast<unsigned int>(mapData_.size());
-        numOfColms_ = static_cast<unsigned int>(mapData_[0].size());
         mapSizeInPixels_.x = numOfColms_ * tileSize_.y + (numOfColms_ + 1) * tileSpacing_;
         mapSizeInPixels_.y = numOfRows_ * tileSize_.x + (numOfRows_ + 1) * tileSpacing_;
         backgroundTile_.setSize({static_cast<float>(mapSizeInPixels_.x), static_cast<float>(mapSizeInPixels_.y)});
     }
 
-    void Grid::setCollidable(Tile &tile, bool collidable, bool attachCollider) {
+    void Grid::setCollidable(const Index& index, bool collidable, bool attachCollider) {
+        if (tileStorage_->isCollidable(index) == collidable)
+            return;
+
+        tileStorage_->setCollidable(index, collidable);
+        chunkRenderer_->markDirty(index);
+        markChanged(index);
+
+        auto tile = tiles_.find(getDataIndex(index));
+        if (tile != tiles_.end())
+            setCollidable(*tile->second, collidable);
+    }
+
+    void Grid::setCollidable(Tile &tile, bool collidable) const {
         if (tile.isCollidable() == collidable)
             return;
 
@@ -167,55 +286,86 @@ namespace mighter2d {
         mapPos_.y = static_cast<float>(y);
         backgroundTile_.setPosition(mapPos_);
 
-        for (auto i = 0u; i < tiledMap_.size(); i++) {
-            for (auto j = 0u; j < mapData_[i].size(); j++) {
-                if (i == 0 && j == 0)
-                    tiledMap_[i][j].setPosition(mapPos_.x + tileSpacing_, mapPos_.y + tileSpacing_);
-                else if (j == 0)
-                    tiledMap_[i][j].setPosition( {mapPos_.x + tileSpacing_, tiledMap_[i - 1][j].getPosition().y + tileSize_.y + tileSpacing_});
-                else
-                    tiledMap_[i][j].setPosition( {tiledMap_[i][j - 1].getPosition().x + tileSize_.x + tileSpacing_, tiledMap_[i][j - 1].getPosition().y});
-            }
-        }
+        // Tile positions are derived from mapPos_, so the tiles are not updated
+        updateOccupiedTiles();
+        tileStorage_->setFocusPoints(getFocusIndexes(), streamingRadius_);
+        emitChange(Property{"position", mapPos_});
     }
 
     Vector2f Grid::getPosition() const {
         return mapPos_;
     }
 
-    void Grid::createTiledMap() {
-        for (auto i = 0u; i < mapData_.size(); i++) {
-            auto row = std::vector<Tile>{};
-            for (auto j = 0u; j < mapData_[i].size(); j++) {
-                row.emplace_back(Tile(scene_, tileSize_, {-99, -99}));
-                if (i == 0 && j == 0)
-                    row.back().setPosition(mapPos_.x + tileSpacing_, mapPos_.y + tileSpacing_);
-                else if (j == 0)
-                    row.back().setPosition( {mapPos_.x + tileSpacing_, tiledMap_[i - 1][j].getPosition().y + tileSize_.y + tileSpacing_});
-                else
-                    row.back().setPosition( {row[j - 1].getPosition().x + tileSize_.x + tileSpacing_, row[j - 1].getPosition().y});
-
-                row.back().setId(mapData_[i][j]);
-                row.back().setIndex({static_cast<int>(i), static_cast<int>(j)});
-                row.back().setVisible(renderer_.isVisible());
-                row.back().setFillColour(renderer_.getTileColour());
-            }
-            tiledMap_.push_back(std::move(row));
+    void Grid::createTiledMap(const Map& map) {
+        auto colms = map.empty() ? 0u : static_cast<unsigned int>(map[0].size());
+        createTiledMap(static_cast<unsigned int>(map.size()), colms, '\0');
+
+        // Rows shorter than the first row are padded with the default id
+        for (auto i = 0u; i < numOfRows_; i++) {
+            for (auto j = 0u; j < std::min(map[i].size(), static_cast<std::size_t>(numOfColms_)); j++)
+                tileStorage_->setId({static_cast<int>(i), static_cast<int>(j)}, map[i][j]);
         }
     }
 
+    void Grid::createTiledMap(unsigned int rows, unsigned int colms, char id) {
+        tileStorage_->create(rows, colms, id);
+        resetTiledMap();
+    }
+
+    void Grid::resetTiledMap() {
+        numOfRows_ = tileStorage_->getRowCount();
+        numOfColms_ = tileStorage_->getColumnCount();
+        tiles_.clear();
+        chunkRenderer_->clear();
+        updateOccupiedTiles();
+        markAllChanged();
+    }
+
+    std::size_t Grid::getDataIndex(const Index &index) const {
+        return static_cast<std::size_t>(index.row) * numOfColms_ + static_cast<std::size_t>(index.colm);
+    }
+
+    Index Grid::getIndex(std::size_t dataIndex) const {
+        return {static_cast<int>(dataIndex / numOfColms_), static_cast<int>(dataIndex % numOfColms_)};
+    }
+
+    Vector2f Grid::getTilePosition(const Index &index) const {
+        return mapPos_ + getTileOffset(index);
+    }
+
+    Vector2f Grid::getTileOffset(const Index &index) const {
+        return {static_cast<float>(tileSpacing_ + index.colm * (tileSize_.x + tileSpacing_)),
+                static_cast<float>(tileSpacing_ + index.row * (tileSize_.y + tileSpacing_))};
+    }
+
+    std::unique_ptr<Tile> Grid::createTile() const {
+        // The grid draws its tiles, so they are not drawn by their render layer
+        auto tile = std::make_unique<Tile>(scene_, tileSize_, Vector2f{0, 0});
+        removeFromRenderLayer(scene_, *tile);
+        removeFromRenderLayer(scene_, tile->tile_);
+        return tile;
+    }
+
+    void Grid::loadTile(const Index& index, Tile &tile) const {
+        bool isCollidable = tileStorage_->isCollidable(index);
+        tile.setGridPosition(&mapPos_, getTileOffset(index));
+        tile.setId(tileStorage_->getId(index));
+        tile.setIndex(index);
+        tile.setCollidable(isCollidable);
+        tile.setVisible(renderer_.isVisible());
+        tile.setFillColour(isCollidable ? renderer_.getCollidableTileColour() : renderer_.getTileColour());
+    }
+
     void Grid::draw(priv::RenderTarget &renderTarget) const {
-        /*if (renderer_.isVisible()) {
+        if (renderer_.isVisible()) {
             renderTarget.draw(backgroundTile_);
-            forEachTile([&renderTarget](const Tile &tile) {
-                renderTarget.draw(tile);
-            });
-        }*/
+            chunkRenderer_->draw(renderTarget, *tileStorage_, mapPos_);
+        }
     }
 
     void Grid::setCollidableByIndex(const Index &index, bool isCollidable, bool attachCollider) {
         if (isIndexValid(index))
-            setCollidable(tiledMap_[index.row][index.colm], isCollidable, attachCollider);
+            setCollidable(index, isCollidable, attachCollider);
     }
 
     void Grid::setCollidableByIndex(const std::initializer_list<Index> &locations, bool isCollidable, bool attachCollider) {
@@ -231,44 +381,179 @@ namespace mighter2d {
         }
     }
 
-    void Grid::setCollidableById(char id, bool isCollidable, bool attachCollider) {
-        forEachTile_([=](Tile& tile) {
+    void Grid::setCollidableById(char id, bool isCollidable, bool) {
+        tileStorage_->setCollidableById(id, false, isCollidable);
+        chunkRenderer_->markAllDirty();
+        markAllChanged();
+        forEachCreatedTile([=](Tile& tile) {
             if (tile.getId() == id)
-                setCollidable(tile, isCollidable, attachCollider);
+                setCollidable(tile, isCollidable);
         });
     }
 
-    void Grid::setCollidableByExclusion(char id, bool isCollidable, bool attachCollider) {
-        forEachTile_([=](Tile& tile) {
+    void Grid::setCollidableByExclusion(char id, bool isCollidable, bool) {
+        tileStorage_->setCollidableById(id, true, isCollidable);
+        chunkRenderer_->markAllDirty();
+        markAllChanged();
+        forEachCreatedTile([=](Tile& tile) {
             if (tile.getId() != id)
-                setCollidable(tile, isCollidable, attachCollider);
+                setCollidable(tile, isCollidable);
         });
     }
 
     const Tile& Grid::getTile(const Index &index) const {
-        if (isIndexValid(index))
-            return tiledMap_[index.row][index.colm];
+        if (!isIndexValid(index))
+            return invalidTile_;
+
+        auto& tile = tiles_[getDataIndex(index)];
+        if (!tile) {
+            tile = createTile();
+            loadTile(index, *tile);
+        }
 
-        return invalidTile_;
+        return *tile;
     }
 
     bool Grid::isCollidable(const Index &index) const {
         if (isIndexValid(index))
-            return tiledMap_[index.row][index.colm].isCollidable();
+            return tileStorage_->isCollidable(index);
 
         return false;
     }
 
+    bool Grid::isTileAccessible(const Index &index) const {
+        if (!isIndexValid(index) || tileStorage_->isCollidable(index))
+            return false;
+
+        auto occupants = tileOccupants_.find(getDataIndex(index));
+        if (occupants == tileOccupants_.end())
+            return true;
+
+        return std::none_of(occupants->second.begin(), occupants->second.end(), [](const GridObject* child) {
+            return child->isObstacle() && child->isActive();
+        });
+    }
+
+    bool Grid::isTileAccessible(const Tile &tile) const {
+        return isTileAccessible(tile.getIndex());
+    }
+
+    char Grid::getTileId(const Index &index) const {
+        if (isIndexValid(index))
+            return tileStorage_->getId(index);
+
+        return '\0';
+    }
+
+    void Grid::setTileUserBits(const Index &index, Uint32 bits) {
+        if (isIndexValid(index))
+            tileStorage_->setUserBits(index, bits);
+    }
+
+    void Grid::setMovementCostById(char id, float cost) {
+        if (movementCosts_[static_cast<unsigned char>(id)] != cost) {
+            movementCosts_[static_cast<unsigned char>(id)] = cost;
+            markAllChanged();
+        }
+    }
+
+    float Grid::getMovementCostById(char id) const {
+        return movementCosts_[static_cast<unsigned char>(id)];
+    }
+
+    float Grid::getMovementCost(const Index &index) const {
+        if (isIndexValid(index))
+            return movementCosts_[static_cast<unsigned char>(tileStorage_->getId(index))];
+
+        return 1.0f;
+    }
+
+    Uint64 Grid::getVersion() const {
+        return version_;
+    }
+
+    bool Grid::getChangedTiles(Uint64 version, std::vector<Index>& changedTiles) const {
+        if (version < changeLogVersion_ || version > version_)
+            return false;
+
+        changedTiles.assign(changedTiles_.begin() + static_cast<std::ptrdiff_t>(version - changeLogVersion_), changedTiles_.end());
+        return true;
+    }
+
+    bool Grid::isReachable(const Index &sourceTile, const Index &targetTile) const {
+        if (isStreamed())
+            return isIndexValid(sourceTile) && isTileAccessible(targetTile);
+
+        return components_->isReachable(*this, sourceTile, targetTile);
+    }
+
+    FlowField& Grid::getFlowField(const Index &destination) {
+        MIGHTER2D_ASSERT(!isStreamed(), "Flow fields are not supported on a streamed grid")
+
+        auto& flowField = flowFields_[destination];
+        if (flowField)
+            flowField->update();
+        else
+            flowField = std::make_unique<FlowField>(*this, destination);
+
+        return *flowField;
+    }
+
+    void Grid::removeFlowField(const Index &destination) {
+        flowFields_.erase(destination);
+    }
+
+    void Grid::removeAllFlowFields() {
+        flowFields_.clear();
+    }
+
+    void Grid::markChanged(const Index &index) {
+        version_++;
+
+        // An overflowing log is discarded, older versions can then only be brought up to date completely
+        if (changedTiles_.size() == MAX_CHANGE_LOG_SIZE) {
+            changedTiles_.clear();
+            changeLogVersion_ = version_;
+        } else
+            changedTiles_.push_back(index);
+    }
+
+    void Grid::markAllChanged() {
+        version_++;
+        changedTiles_.clear();
+        changeLogVersion_ = version_;
+    }
+
+    Uint32 Grid::getTileUserBits(const Index &index) const {
+        if (isIndexValid(index))
+            return tileStorage_->getUserBits(index);
+
+        return 0;
+    }
+
     bool Grid::addChild(GridObject* child, const Index& index) {
         MIGHTER2D_ASSERT(child, "Child cannot be a nullptr")
         if (isIndexValid(index) && children_.insert(child).second) {
             // Automatically remove the child from the grid when it is destroyed
             destructionIds_[child->getObjectId()] = child->onDestruction([this, child] {
                 destructionIds_.erase(child->getObjectId());
+                propertyChangeIds_.erase(child->getObjectId());
+                removeFromOccupiedTile(child);
                 children_.erase(child);
             });
 
+            // Keep the occupancy buckets and the change log up to date no matter what modifies the child
+            propertyChangeIds_[child->getObjectId()] = child->onPropertyChange([this, child](const Property& property) {
+                if (property.getName() == "position")
+                    updateOccupiedTile(child);
+                else if (property.getName() == "obstacle" || (property.getName() == "active" && child->isObstacle())) {
+                    if (auto occupiedTile = occupiedTiles_.find(child); occupiedTile != occupiedTiles_.end())
+                        markChanged(getIndex(occupiedTile->second));
+                }
+            });
+
             child->getTransform().setPosition(getTile(index).getWorldCentre());
+            updateOccupiedTile(child);
             child->setGrid(this);
 
             return true;
@@ -278,7 +563,7 @@ namespace mighter2d {
     }
 
     bool Grid::hasChild(const GridObject* child) const {
-        return std::find(children_.begin(), children_.end(), child) != children_.end();
+        return children_.find(const_cast<GridObject*>(child)) != children_.end();
     }
 
     GridObject* Grid::getChildWithId(std::size_t id) const {
@@ -297,10 +582,38 @@ namespace mighter2d {
     }
 
     void Grid::forEachChildInTile(const Tile& tile, const Callback<GridObject*>& callback) const {
-        forEachChild([&](GridObject* child) {
-            if (isInTile(child, tile))
-                callback(child);
-        });
+        forEachChildInTile(tile.getIndex(), callback);
+    }
+
+    void Grid::forEachChildInTile(const Index& index, const Callback<GridObject*>& callback) const {
+        if (!isIndexValid(index))
+            return;
+
+        // The callback may add, move or remove children, which changes or erases
+        // the bucket. The bucket is therefore looked up again after each call
+        // instead of being copied, and a position is only advanced past a child
+        // that is still in the tile
+        const std::size_t dataIndex = getDataIndex(index);
+        auto occupants = tileOccupants_.find(dataIndex);
+        if (occupants == tileOccupants_.end())
+            return;
+
+        std::size_t remaining = occupants->second.size();
+        std::size_t position = 0;
+
+        while (remaining-- > 0) {
+            occupants = tileOccupants_.find(dataIndex);
+            if (occupants == tileOccupants_.end() || position >= occupants->second.size())
+                return;
+
+            GridObject* child = occupants->second[position];
+            callback(child);
+
+            occupants = tileOccupants_.find(dataIndex);
+            bool isPositionValid = occupants != tileOccupants_.end() && position < occupants->second.size();
+            if (isPositionValid && occupants->second[position] == child)
+                position++;
+        }
     }
 
     void Grid::update(Time) {
@@ -311,6 +624,8 @@ namespace mighter2d {
         for (auto& child : children_) {
             if (child->getObjectId() == id) {
                 unsubscribeDestructionListener(child);
+                unsubscribePropertyChangeListener(child);
+                removeFromOccupiedTile(child);
                 GridObject* copy = child;
                 children_.erase(child);
                 copy->setGrid(nullptr);
@@ -334,6 +649,8 @@ namespace mighter2d {
             if (callback(*iter)) {
                 GridObject* gameObject = *iter;
                 unsubscribeDestructionListener(gameObject);
+                unsubscribePropertyChangeListener(gameObject);
+                removeFromOccupiedTile(gameObject);
                 iter = children_.erase(iter);
                 gameObject->setGrid(nullptr);
             } else
@@ -361,15 +678,14 @@ namespace mighter2d {
     }
 
     void Grid::forEachTile(const Callback<const Tile&>& callback) const {
-        std::for_each(tiledMap_.begin(), tiledMap_.end(), [&callback](auto& row) {
-            std::for_each(row.begin(), row.end(), callback);
-        });
+        std::unique_ptr<Tile> tempTile;
+        for (auto i = 0u; i < numOfRows_; i++)
+            forEachTileInRow(Index{static_cast<int>(i), 0}, numOfColms_, callback, tempTile);
     }
 
-    void Grid::forEachTile_(const Callback<Tile&> &callback) {
-        std::for_each(tiledMap_.begin(), tiledMap_.end(), [&callback](auto& row) {
-            std::for_each(row.begin(), row.end(), callback);
-        });
+    void Grid::forEachCreatedTile(const Callback<Tile&> &callback) {
+        for (auto& [dataIndex, tile] : tiles_)
+            callback(*tile);
     }
 
     void Grid::forEachTileWithId(char id, const Callback<const Tile&>& callback) const {
@@ -387,12 +703,29 @@ namespace mighter2d {
     }
 
     void Grid::forEachTileInRange(Index startPos, Index endPos, const Callback<const Tile&>& callback) const {
-        if (isIndexValid(startPos) && isIndexValid(endPos)) {
-            std::for_each(tiledMap_[startPos.row].begin() + startPos.colm,
-                tiledMap_[startPos.row].begin() + endPos.colm,
-                [&callback](const Tile& tile) {
-                    callback(tile);
-            });
+        if (isIndexValid(startPos) && isIndexValid(endPos) && startPos.colm < endPos.colm) {
+            std::unique_ptr<Tile> tempTile;
+            forEachTileInRow(startPos, static_cast<unsigned int>(endPos.colm - startPos.colm), callback, tempTile);
+        }
+    }
+
+    void Grid::forEachTileInRow(const Index& startPos, unsigned int count, const Callback<const Tile&> &callback,
+        std::unique_ptr<Tile>& tempTile) const
+    {
+        // Tiles that have not been created are visited through a temporary tile
+        for (auto i = 0u; i < count; i++) {
+            auto index = Index{startPos.row, startPos.colm + static_cast<int>(i)};
+            auto tile = tiles_.find(getDataIndex(index));
+
+            if (tile != tiles_.end())
+                callback(*tile->second);
+            else {
+                if (!tempTile)
+                    tempTile = createTile();
+
+                loadTile(index, *tempTile);
+                callback(*tempTile);
+            }
         }
     }
 
@@ -436,15 +769,16 @@ namespace mighter2d {
     }
 
     bool Grid::isTileOccupied(const Index &index) const {
-        return std::any_of(children_.begin(), children_.end(), [this, &index] (GridObject* child) {
-            return isInTile(child, tiledMap_[index.row][index.colm]);
-        });
+        if (!isIndexValid(index))
+            return false;
+
+        return tileOccupants_.find(getDataIndex(index)) != tileOccupants_.end();
     }
 
     void Grid::onRenderChange(const Property &property) {
         if (property.getName() == "visible") {
             auto visible = property.getValue<bool>();
-            forEachTile_([visible](Tile& tile) {
+            forEachCreatedTile([visible](Tile& tile) {
                 tile.setVisible(visible);
             });
 
@@ -453,12 +787,14 @@ namespace mighter2d {
             else
                 backgroundTile_.setFillColour(mighter2d::Colour::Transparent);
         } else if (property.getName() == "tileColour") {
-            forEachTile_([&property](Tile& tile) {
+            chunkRenderer_->setColours(property.getValue<Colour>(), renderer_.getCollidableTileColour());
+            forEachCreatedTile([&property](Tile& tile) {
                 if (!tile.isCollidable())
                     tile.setFillColour(property.getValue<Colour>());
             });
         } else if (property.getName() == "collidableTileColour") {
-            forEachTile_([&property](Tile& tile) {
+            chunkRenderer_->setColours(renderer_.getTileColour(), property.getValue<Colour>());
+            forEachCreatedTile([&property](Tile& tile) {
                 if (tile.isCollidable())
                     tile.setFillColour(property.getValue<Colour>());
             });
@@ -473,6 +809,67 @@ namespace mighter2d {
         destructionIds_.erase(child->getObjectId());
     }
 
+    void Grid::unsubscribePropertyChangeListener(GridObject *child) {
+        child->removeEventListener("Object_propertyChange", propertyChangeIds_[child->getObjectId()]);
+        propertyChangeIds_.erase(child->getObjectId());
+    }
+
+    void Grid::updateOccupiedTile(GridObject *child) {
+        auto index = getIndexAt(child->getTransform().getPosition());
+        auto occupiedTile = occupiedTiles_.find(child);
+
+        if (index.row == -1) {
+            removeFromOccupiedTile(child);
+            return;
+        }
+
+        auto dataIndex = getDataIndex(index);
+        if (occupiedTile != occupiedTiles_.end()) {
+            if (occupiedTile->second == dataIndex)
+                return;
+
+            removeFromOccupiedTile(child);
+        }
+
+        occupiedTiles_[child] = dataIndex;
+        tileOccupants_[dataIndex].push_back(child);
+
+        if (child->isObstacle())
+            markChanged(index);
+    }
+
+    void Grid::updateOccupiedTiles() {
+        for (const auto& [child, dataIndex] : occupiedTiles_) {
+            if (child->isObstacle())
+                markChanged(getIndex(dataIndex));
+        }
+
+        occupiedTiles_.clear();
+        tileOccupants_.clear();
+
+        for (auto* child : children_)
+            updateOccupiedTile(child);
+    }
+
+    void Grid::removeFromOccupiedTile(GridObject *child) {
+        auto occupiedTile = occupiedTiles_.find(child);
+        if (occupiedTile == occupiedTiles_.end())
+            return;
+
+        if (child->isObstacle())
+            markChanged(getIndex(occupiedTile->second));
+
+        auto occupants = tileOccupants_.find(occupiedTile->second);
+        auto& children = occupants->second;
+        children.erase(std::find(children.begin(), children.end(), child));
+
+        // Only occupied tiles have a bucket
+        if (children.empty())
+            tileOccupants_.erase(occupants);
+
+        occupiedTiles_.erase(occupiedTile);
+    }
+
     Grid::~Grid() {
         emitDestruction();
         removeAllChildren();
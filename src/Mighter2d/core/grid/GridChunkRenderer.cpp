@@ -0,0 +1,155 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/grid/GridChunkRenderer.h"
+#include "Mighter2d/core/grid/TileStorage.h"
+#include "Mighter2d/graphics/RenderTarget.h"
+#include "Mighter2d/graphics/VisibleChunks.h"
+#include "Mighter2d/utility/Helpers.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace mighter2d::priv {
+    namespace {
+        constexpr auto CHUNK_SIZE = static_cast<unsigned int>(TileStorage::CHUNK_SIZE);
+        constexpr std::size_t VERTICES_PER_TILE = 6;
+
+        /**
+         * @brief Get the key of the batch of a chunk
+         * @param chunkRow The row of the chunk
+         * @param chunkColm The column of the chunk
+         * @return The key of the batch
+         */
+        std::uint64_t getBatchKey(unsigned int chunkRow, unsigned int chunkColm) {
+            return (static_cast<std::uint64_t>(chunkRow) << 32) | chunkColm;
+        }
+    }
+
+    GridChunkRenderer::GridChunkRenderer(Vector2u tileSize, unsigned int tileSpacing) :
+        tileSize_{static_cast<float>(tileSize.x), static_cast<float>(tileSize.y)},
+        tileSpacing_{static_cast<float>(tileSpacing)},
+        frame_{0},
+        drawnChunkCount_{0}
+    {}
+
+    void GridChunkRenderer::setColours(const Colour &tileColour, const Colour &collidableTileColour) {
+        tileColour_ = tileColour;
+        collidableTileColour_ = collidableTileColour;
+        markAllDirty();
+    }
+
+    void GridChunkRenderer::markDirty(const Index &index) {
+        if (batches_.empty())
+            return;
+
+        auto key = getBatchKey(static_cast<unsigned int>(index.row) / CHUNK_SIZE, static_cast<unsigned int>(index.colm) / CHUNK_SIZE);
+
+        if (auto found = batches_.find(key); found != batches_.end())
+            found->second.isDirty = true;
+    }
+
+    void GridChunkRenderer::markAllDirty() {
+        for (auto& [key, batch] : batches_)
+            batch.isDirty = true;
+    }
+
+    void GridChunkRenderer::clear() {
+        batches_.clear();
+    }
+
+    void GridChunkRenderer::draw(RenderTarget &renderTarget, const TileStorage &tiles, const Vector2f &position) {
+        frame_++;
+        drawnChunkCount_ = 0;
+
+        Vector2f chunkSize{static_cast<float>(CHUNK_SIZE) * (tileSize_.x + tileSpacing_),
+                           static_cast<float>(CHUNK_SIZE) * (tileSize_.y + tileSpacing_)};
+        auto visibleChunks = getVisibleChunks(renderTarget, position, chunkSize,
+            (tiles.getRowCount() + CHUNK_SIZE - 1) / CHUNK_SIZE, (tiles.getColumnCount() + CHUNK_SIZE - 1) / CHUNK_SIZE);
+
+        if (visibleChunks) {
+            sf::RenderStates states;
+            states.transform.translate(static_cast<float>(position.x), static_cast<float>(position.y));
+
+            for (auto chunkRow = visibleChunks->firstRow; chunkRow <= visibleChunks->lastRow; ++chunkRow) {
+                for (auto chunkColm = visibleChunks->firstColm; chunkColm <= visibleChunks->lastColm; ++chunkColm) {
+                    Batch& batch = batches_[getBatchKey(chunkRow, chunkColm)];
+
+                    if (batch.isDirty)
+                        build(batch, tiles, chunkRow, chunkColm);
+
+                    batch.lastDrawnFrame = frame_;
+                    renderTarget.draw(batch.vertices, states);
+                    drawnChunkCount_++;
+                }
+            }
+        }
+
+        // Release the vertices of the chunks that scrolled out of view
+        if (batches_.size() > drawnChunkCount_) {
+            for (auto iter = batches_.begin(); iter != batches_.end();) {
+                if (iter->second.lastDrawnFrame != frame_)
+                    iter = batches_.erase(iter);
+                else
+                    ++iter;
+            }
+        }
+    }
+
+    std::size_t GridChunkRenderer::getDrawnChunkCount() const {
+        return drawnChunkCount_;
+    }
+
+    void GridChunkRenderer::build(Batch& batch, const TileStorage& tiles, unsigned int chunkRow, unsigned int chunkColm) const {
+        auto firstRow = chunkRow * CHUNK_SIZE;
+        auto firstColm = chunkColm * CHUNK_SIZE;
+        auto lastRow = std::min(firstRow + CHUNK_SIZE, tiles.getRowCount());
+        auto lastColm = std::min(firstColm + CHUNK_SIZE, tiles.getColumnCount());
+        sf::Color tileColour = utility::convertToSFMLColour(tileColour_);
+        sf::Color collidableTileColour = utility::convertToSFMLColour(collidableTileColour_);
+
+        batch.vertices.setPrimitiveType(sf::Triangles);
+        batch.vertices.resize(static_cast<std::size_t>(lastRow - firstRow) * (lastColm - firstColm) * VERTICES_PER_TILE);
+        std::size_t vertex = 0;
+
+        for (auto row = firstRow; row < lastRow; ++row) {
+            float top = tileSpacing_ + static_cast<float>(row) * (tileSize_.y + tileSpacing_);
+            float bottom = top + tileSize_.y;
+
+            for (auto colm = firstColm; colm < lastColm; ++colm) {
+                float left = tileSpacing_ + static_cast<float>(colm) * (tileSize_.x + tileSpacing_);
+                float right = left + tileSize_.x;
+                const sf::Color& colour = tiles.isCollidable(Index{static_cast<int>(row), static_cast<int>(colm)}) ? collidableTileColour : tileColour;
+
+                batch.vertices[vertex++] = sf::Vertex({left, top}, colour);
+                batch.vertices[vertex++] = sf::Vertex({right, top}, colour);
+                batch.vertices[vertex++] = sf::Vertex({left, bottom}, colour);
+                batch.vertices[vertex++] = sf::Vertex({left, bottom}, colour);
+                batch.vertices[vertex++] = sf::Vertex({right, top}, colour);
+                batch.vertices[vertex++] = sf::Vertex({right, bottom}, colour);
+            }
+        }
+
+        batch.isDirty = false;
+    }
+}
@@ -0,0 +1,133 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_GRIDCHUNKRENDERER_H
+#define MIGHTER2D_GRIDCHUNKRENDERER_H
+
+#include "Mighter2d/common/Vector2.h"
+#include "Mighter2d/core/grid/Index.h"
+#include "Mighter2d/graphics/Colour.h"
+#include <SFML/Graphics/VertexArray.hpp>
+#include <cstdint>
+#include <unordered_map>
+
+namespace mighter2d::priv {
+    class RenderTarget;
+    class TileStorage;
+
+    /**
+     * @brief Draws the tiles of a Grid in batches
+     *
+     * The tiles of each chunk of a TileStorage are emitted into a single
+     * vertex array, so a chunk is drawn with one draw call. Only the chunks
+     * that intersect the view of the render target are built and drawn, and
+     * a chunk is only rebuilt after it is marked dirty. The vertices are
+     * relative to the position of the grid, so moving the grid does not
+     * require a rebuild
+     */
+    class GridChunkRenderer {
+    public:
+        /**
+         * @brief Constructor
+         * @param tileSize The size of each tile
+         * @param tileSpacing The spacing between tiles in all directions
+         */
+        GridChunkRenderer(Vector2u tileSize, unsigned int tileSpacing);
+
+        /**
+         * @brief Set the colours of the tiles
+         * @param tileColour The colour of the tiles that are not collidable
+         * @param collidableTileColour The colour of the collidable tiles
+         *
+         * All the chunks are marked dirty
+         */
+        void setColours(const Colour& tileColour, const Colour& collidableTileColour);
+
+        /**
+         * @brief Mark the chunk containing a tile as dirty
+         * @param index The index of the tile whose appearance changed
+         */
+        void markDirty(const Index& index);
+
+        /**
+         * @brief Mark all the chunks as dirty
+         */
+        void markAllDirty();
+
+        /**
+         * @brief Remove all the batches
+         *
+         * This function must be called when the dimensions of the grid change
+         */
+        void clear();
+
+        /**
+         * @brief Draw the tiles that intersect the view of a render target
+         * @param renderTarget The target to draw the tiles on
+         * @param tiles The tiles to be drawn
+         * @param position The position of the grid
+         *
+         * Dirty chunks are rebuilt before they are drawn. The batches of the
+         * chunks that are no longer in view are released
+         */
+        void draw(RenderTarget& renderTarget, const TileStorage& tiles, const Vector2f& position);
+
+        /**
+         * @brief Get the number of chunks drawn by the last call to draw()
+         * @return The number of chunks drawn, which is also the number of
+         *         draw calls issued for the tiles
+         */
+        std::size_t getDrawnChunkCount() const;
+
+    private:
+        /**
+         * @brief The vertices of the tiles of a chunk
+         */
+        struct Batch {
+            sf::VertexArray vertices;      //!< Two triangles per tile
+            bool isDirty = true;           //!< A flag indicating whether or not the vertices are out of date
+            std::size_t lastDrawnFrame = 0; //!< The last frame in which the chunk was drawn
+        };
+
+        /**
+         * @brief Fill the vertex array of a chunk
+         * @param batch The batch to be filled
+         * @param tiles The tiles to be drawn
+         * @param chunkRow The row of the chunk
+         * @param chunkColm The column of the chunk
+         */
+        void build(Batch& batch, const TileStorage& tiles, unsigned int chunkRow, unsigned int chunkColm) const;
+
+    private:
+        Vector2f tileSize_;                              //!< The size of each tile
+        float tileSpacing_;                              //!< The spacing between tiles in all directions
+        Colour tileColour_;                              //!< The colour of the tiles that are not collidable
+        Colour collidableTileColour_;                    //!< The colour of the collidable tiles
+        std::unordered_map<std::uint64_t, Batch> batches_; //!< The batches of the visible chunks (key = chunk row and column)
+        std::size_t frame_;                              //!< The number of calls to draw()
+        std::size_t drawnChunkCount_;                    //!< The number of chunks drawn by the last call to draw()
+    };
+}
+
+#endif
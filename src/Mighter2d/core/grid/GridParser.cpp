@@ -23,28 +23,56 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Mighter2d/core/grid/GridParser.h"
-#include "Mighter2d/utility/DiskFileReader.h"
+#include "Mighter2d/utility/MemoryMappedFile.h"
 #include "Mighter2d/core/exceptions/Exceptions.h"
-#include <sstream>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
 
 namespace mighter2d {
+    namespace {
+        const char BINARY_MAGIC[4] = {'M', '2', 'D', 'G'};
+        const unsigned int BINARY_VERSION = 1;
+
+        unsigned int readUint32(const char* data) {
+            const auto* bytes = reinterpret_cast<const unsigned char*>(data);
+            return static_cast<unsigned int>(bytes[0]) | (static_cast<unsigned int>(bytes[1]) << 8) |
+                (static_cast<unsigned int>(bytes[2]) << 16) | (static_cast<unsigned int>(bytes[3]) << 24);
+        }
+
+        void writeUint32(std::ofstream& file, unsigned int value) {
+            for (auto i = 0; i < 4; i++)
+                file.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+        }
+    }
+
     GridParser::Map GridParser::parse(const std::string &filename, char separator) {
         Map map;
-        std::stringstream mapData;
-        utility::DiskFileReader().readFileInto(filename, mapData);
-        std::string line;
+        priv::MemoryMappedFile file;
+        file.open(filename);
+
+        const char* data = file.getData();
+        const char* end = data + file.getSize();
+
+        for (const char* line = data; line && line < end; ) {
+            const auto* next = static_cast<const char*>(std::memchr(line, '\n', static_cast<std::size_t>(end - line)));
+            const char* lineEnd = next ? next : end;
+            if (lineEnd > line && *(lineEnd - 1) == '\r')
+                lineEnd--;
 
-        while (std::getline(mapData, line)) {
             ////Skip lines that are empty or begin with a comment
-            if (line.empty() || line[0] == '#')
-                continue;
+            if (lineEnd != line && *line != '#') {
+                std::vector<char> row;
+                row.reserve(static_cast<std::size_t>(lineEnd - line));
+                std::copy_if(line, lineEnd, std::back_inserter(row), [separator](char character) {
+                    return character != separator;
+                });
 
-            std::vector<char> row;
-            for (const auto& character : line) {
-                if (character != separator)
-                    row.push_back(character);
+                map.push_back(std::move(row));
             }
-            map.push_back(row);
+
+            line = next ? next + 1 : end;
         }
 
         if (map.empty())
@@ -52,4 +80,44 @@ namespace mighter2d {
 
         return map;
     }
-}
\ No newline at end of file
+
+    bool GridParser::isBinary(const std::string &filename) {
+        char magic[sizeof(BINARY_MAGIC)] = {};
+        std::ifstream file(filename, std::ios::binary);
+        return file.read(magic, sizeof(magic)) && std::memcmp(magic, BINARY_MAGIC, sizeof(magic)) == 0;
+    }
+
+    bool GridParser::readBinaryHeader(const std::string& filename, const char *data, std::size_t size, BinaryHeader &header) {
+        if (size < sizeof(BINARY_MAGIC) || std::memcmp(data, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0)
+            return false;
+
+        if (size < BINARY_HEADER_SIZE || readUint32(data + 4) != BINARY_VERSION)
+            throw InvalidParseException("Failed to parse \'" + filename + "\', unsupported binary 'mighter2d::Grid' map file version.");
+
+        header.rows = readUint32(data + 8);
+        header.colms = readUint32(data + 12);
+
+        if (header.rows == 0 || header.colms == 0 || (size - BINARY_HEADER_SIZE) / header.rows < header.colms)
+            throw InvalidParseException("Failed to parse \'" + filename + "\', the binary 'mighter2d::Grid' map data is incomplete.");
+
+        return true;
+    }
+
+    void GridParser::writeBinary(const Map &map, const std::string &filename) {
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        if (!file.good())
+            throw FileNotFoundException(R"(Cannot find file ")" + filename + R"(")");
+
+        auto colms = map.empty() ? 0u : static_cast<unsigned int>(map[0].size());
+        file.write(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+        writeUint32(file, BINARY_VERSION);
+        writeUint32(file, static_cast<unsigned int>(map.size()));
+        writeUint32(file, colms);
+
+        std::vector<char> row(colms, '\0');
+        for (const auto& mapRow : map) {
+            std::fill(std::copy_n(mapRow.begin(), std::min(mapRow.size(), row.size()), row.begin()), row.end(), '\0');
+            file.write(row.data(), static_cast<std::streamsize>(row.size()));
+        }
+    }
+}
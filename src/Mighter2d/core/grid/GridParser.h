@@ -25,17 +25,36 @@
 #ifndef MIGHTER2D_GRIDPARSER_H
 #define MIGHTER2D_GRIDPARSER_H
 
+#include <cstddef>
 #include <vector>
 #include <string>
 
 namespace mighter2d {
     /**
      * @brief Reads a file containing the grid data and returns it in grid form
+     *
+     * Grid data is stored either as text, one row of tile ids per line, or
+     * in a compact binary format. A binary file consists of a 16 byte
+     * header followed by the tile ids in row-major order. The header holds
+     * the characters "M2DG", the format version, the number of rows and
+     * the number of columns, each stored as a little-endian 32-bit unsigned
+     * integer. Because the tile ids are stored as is, a binary file can be
+     * used directly once it is mapped into memory
      */
     class GridParser {
     public:
         using Map = std::vector<std::vector<char>>; //!< Alias for 2D vector of chars
 
+        static constexpr std::size_t BINARY_HEADER_SIZE = 16; //!< The size of the header of a binary map file in bytes
+
+        /**
+         * @brief The dimensions of the map stored in a binary map file
+         */
+        struct BinaryHeader {
+            unsigned int rows = 0;     //!< The number of rows
+            unsigned int colms = 0;    //!< The number of columns
+        };
+
         /**
          * @brief Parse a map file
          * @param filename Name of the map file
@@ -48,6 +67,39 @@ namespace mighter2d {
          * form the parsed date
          */
         static Map parse(const std::string& filename, char separator = ',');
+
+        /**
+         * @brief Check if a file is a binary map file or not
+         * @param filename Name of the file to be checked
+         * @return True if the file starts with the binary map file header,
+         *         otherwise false
+         */
+        static bool isBinary(const std::string& filename);
+
+        /**
+         * @brief Read the header of a binary map file
+         * @param filename Name of the map file, used in error messages
+         * @param data The content of the file
+         * @param size The size of the file in bytes
+         * @param header Receives the dimensions of the map
+         * @return True if the file is a binary map file, or false if the
+         *         file does not start with the binary map file header
+         * @throws InvalidParseException If the file starts with the header
+         *         but is not a valid binary map file
+         *
+         * The tile ids start BINARY_HEADER_SIZE bytes into the file
+         */
+        static bool readBinaryHeader(const std::string& filename, const char* data, std::size_t size, BinaryHeader& header);
+
+        /**
+         * @brief Write a map to a binary map file
+         * @param map The map to be written
+         * @param filename Name of the binary map file
+         * @throws FileNotFoundException If @a filename cannot be opened for writing
+         *
+         * Rows shorter than the first row are padded with '\0'
+         */
+        static void writeBinary(const Map& map, const std::string& filename);
     };
 }
 
@@ -0,0 +1,355 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/grid/TileStorage.h"
+#include "Mighter2d/core/grid/GridParser.h"
+#include "Mighter2d/core/exceptions/Exceptions.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace mighter2d::priv {
+    namespace {
+        constexpr auto CHUNK_TILE_COUNT = static_cast<std::size_t>(TileStorage::CHUNK_SIZE * TileStorage::CHUNK_SIZE);
+
+        unsigned int getChunkCount(unsigned int tileCount) {
+            return (tileCount + TileStorage::CHUNK_SIZE - 1) / TileStorage::CHUNK_SIZE;
+        }
+    }
+
+    TileStorage::TileStorage() :
+        numOfRows_{0},
+        numOfColms_{0},
+        numOfChunkColms_{0},
+        tileStride_{1},
+        isBinary_{false},
+        isStreamed_{false}
+    {}
+
+    void TileStorage::reset(unsigned int rows, unsigned int colms) {
+        numOfRows_ = colms == 0 ? 0u : rows;
+        numOfColms_ = rows == 0 ? 0u : colms;
+        numOfChunkColms_ = getChunkCount(numOfColms_);
+        chunks_.clear();
+        chunks_.resize(static_cast<std::size_t>(getChunkCount(numOfRows_)) * numOfChunkColms_);
+        loadedChunkIds_.clear();
+        collidableRules_.clear();
+    }
+
+    void TileStorage::create(unsigned int rows, unsigned int colms, char id) {
+        file_.close();
+        rowOffsets_.clear();
+        isStreamed_ = false;
+        reset(rows, colms);
+
+        for (auto i = 0u; i < chunks_.size(); i++) {
+            chunks_[i] = std::make_unique<Chunk>();
+            chunks_[i]->ids.assign(CHUNK_TILE_COUNT, id);
+            loadedChunkIds_.push_back(i);
+        }
+    }
+
+    void TileStorage::open(const std::string &filename, char separator, bool isStreamed) {
+        file_.close();
+        rowOffsets_.clear();
+        reset(0, 0);
+        isStreamed_ = false;
+        file_.open(filename);
+
+        try {
+            auto header = GridParser::BinaryHeader{};
+            if (GridParser::readBinaryHeader(filename, file_.getData(), file_.getSize(), header)) {
+                isBinary_ = true;
+                tileStride_ = 1;
+                reset(header.rows, header.colms);
+            } else {
+                isBinary_ = false;
+                indexRows(filename, separator);
+            }
+        } catch (...) {
+            file_.close();
+            throw;
+        }
+
+        isStreamed_ = isStreamed;
+    }
+
+    void TileStorage::indexRows(const std::string &filename, char separator) {
+        // Only the position of the rows is stored, the tiles are read when their chunk is loaded
+        const char* data = file_.getData();
+        const char* end = data + file_.getSize();
+        std::vector<std::size_t> rowOffsets;
+        std::size_t rowLength = 0;
+        tileStride_ = separator == '\0' ? 1 : 2;
+
+        for (const char* line = data; line && line < end; ) {
+            const auto* next = static_cast<const char*>(std::memchr(line, '\n', static_cast<std::size_t>(end - line)));
+            const char* lineEnd = next ? next : end;
+            if (lineEnd > line && *(lineEnd - 1) == '\r')
+                lineEnd--;
+
+            // Skip lines that are empty or begin with a comment
+            if (lineEnd != line && *line != '#') {
+                auto length = static_cast<std::size_t>(lineEnd - line);
+                if (rowOffsets.empty())
+                    rowLength = length;
+                else if (length != rowLength)
+                    throw InvalidParseException("Failed to stream \'" + filename + "\', the rows of a streamed 'mighter2d::Grid' must have the same number of tiles.");
+
+                rowOffsets.push_back(static_cast<std::size_t>(line - data));
+            }
+
+            line = next ? next + 1 : end;
+        }
+
+        if (rowOffsets.empty())
+            throw InvalidParseException("Failed to stream \'" + filename + "\', 'mighter2d::Grid' map data not found. Recall empty lines and comments (lines that start with a '#') are ignored.");
+
+        if (tileStride_ == 2 && rowLength % 2 == 0)
+            throw InvalidParseException("Failed to stream \'" + filename + "\', the tiles of a streamed 'mighter2d::Grid' must be separated by exactly one separator.");
+
+        reset(static_cast<unsigned int>(rowOffsets.size()), static_cast<unsigned int>((rowLength + tileStride_ - 1) / tileStride_));
+        rowOffsets_ = std::move(rowOffsets);
+    }
+
+    bool TileStorage::isStreamed() const {
+        return isStreamed_;
+    }
+
+    unsigned int TileStorage::getRowCount() const {
+        return numOfRows_;
+    }
+
+    unsigned int TileStorage::getColumnCount() const {
+        return numOfColms_;
+    }
+
+    void TileStorage::setId(const Index &index, char id) {
+        Chunk& chunk = getChunk(index);
+        if (chunk.ids.empty())
+            copyIds(getChunkId(index), chunk);
+
+        chunk.ids[getOffsetInChunk(index)] = id;
+        chunk.isModified = true;
+    }
+
+    char TileStorage::getId(const Index &index) const {
+        return getId(getChunk(index), index);
+    }
+
+    void TileStorage::setCollidable(const Index &index, bool isCollidable) {
+        Chunk& chunk = getChunk(index);
+        if (chunk.collidableFlags.empty()) {
+            if (!isCollidable)
+                return;
+
+            chunk.collidableFlags.assign(CHUNK_TILE_COUNT, 0);
+        }
+
+        chunk.collidableFlags[getOffsetInChunk(index)] = static_cast<Uint8>(isCollidable);
+        chunk.isModified = true;
+    }
+
+    bool TileStorage::isCollidable(const Index &index) const {
+        const Chunk& chunk = getChunk(index);
+        return !chunk.collidableFlags.empty() && chunk.collidableFlags[getOffsetInChunk(index)];
+    }
+
+    void TileStorage::setCollidableById(char id, bool isExclusion, bool isCollidable) {
+        auto rule = CollidableRule{id, isExclusion, isCollidable};
+        for (auto chunkId : loadedChunkIds_)
+            applyRule(rule, chunkId, *chunks_[chunkId]);
+
+        if (file_.isOpen()) {
+            // A rule replaces the previous rule for the same tiles
+            collidableRules_.erase(std::remove_if(collidableRules_.begin(), collidableRules_.end(), [&rule](const CollidableRule& other) {
+                return other.id == rule.id && other.isExclusion == rule.isExclusion;
+            }), collidableRules_.end());
+
+            collidableRules_.push_back(rule);
+        }
+    }
+
+    void TileStorage::setUserBits(const Index &index, Uint32 bits) {
+        Chunk& chunk = getChunk(index);
+        if (chunk.userBits.empty()) {
+            if (bits == 0)
+                return;
+
+            chunk.userBits.assign(CHUNK_TILE_COUNT, 0);
+        }
+
+        chunk.userBits[getOffsetInChunk(index)] = bits;
+        chunk.isModified = true;
+    }
+
+    Uint32 TileStorage::getUserBits(const Index &index) const {
+        const Chunk& chunk = getChunk(index);
+        return chunk.userBits.empty() ? 0 : chunk.userBits[getOffsetInChunk(index)];
+    }
+
+    void TileStorage::setFocusPoints(const std::vector<Index> &focusPoints, unsigned int radius) {
+        if (!isStreamed_)
+            return;
+
+        auto toChunk = [](int tile) {
+            return tile >= 0 ? tile / CHUNK_SIZE : (tile + 1) / CHUNK_SIZE - 1;
+        };
+
+        const auto numOfChunkRows = static_cast<int>(getChunkCount(numOfRows_));
+        const auto numOfChunkColms = static_cast<int>(numOfChunkColms_);
+        const auto keepRadius = static_cast<int>(radius) + 1;
+
+        // Evict the chunks that are far from every focus point
+        loadedChunkIds_.erase(std::remove_if(loadedChunkIds_.begin(), loadedChunkIds_.end(), [&](std::size_t chunkId) {
+            if (chunks_[chunkId]->isModified)
+                return false;
+
+            auto chunkRow = static_cast<int>(chunkId / numOfChunkColms_);
+            auto chunkColm = static_cast<int>(chunkId % numOfChunkColms_);
+            bool isNearFocus = std::any_of(focusPoints.begin(), focusPoints.end(), [&](const Index& focus) {
+                return std::abs(toChunk(focus.row) - chunkRow) <= keepRadius && std::abs(toChunk(focus.colm) - chunkColm) <= keepRadius;
+            });
+
+            if (!isNearFocus)
+                chunks_[chunkId].reset();
+
+            return !isNearFocus;
+        }), loadedChunkIds_.end());
+
+        // Load the chunks around each focus point
+        for (const auto& focus : focusPoints) {
+            int firstRow = std::max(toChunk(focus.row) - static_cast<int>(radius), 0);
+            int lastRow = std::min(toChunk(focus.row) + static_cast<int>(radius), numOfChunkRows - 1);
+            int firstColm = std::max(toChunk(focus.colm) - static_cast<int>(radius), 0);
+            int lastColm = std::min(toChunk(focus.colm) + static_cast<int>(radius), numOfChunkColms - 1);
+
+            for (auto chunkRow = firstRow; chunkRow <= lastRow; chunkRow++) {
+                for (auto chunkColm = firstColm; chunkColm <= lastColm; chunkColm++)
+                    getChunk({chunkRow * CHUNK_SIZE, chunkColm * CHUNK_SIZE});
+            }
+        }
+    }
+
+    std::size_t TileStorage::getLoadedChunkCount() const {
+        return loadedChunkIds_.size();
+    }
+
+    std::size_t TileStorage::getChunkId(const Index &index) const {
+        auto chunkRow = static_cast<unsigned int>(index.row) / CHUNK_SIZE;
+        auto chunkColm = static_cast<unsigned int>(index.colm) / CHUNK_SIZE;
+        return static_cast<std::size_t>(chunkRow) * numOfChunkColms_ + chunkColm;
+    }
+
+    TileStorage::Chunk& TileStorage::getChunk(const Index &index) const {
+        auto chunkId = getChunkId(index);
+        auto& chunk = chunks_[chunkId];
+
+        if (!chunk) {
+            chunk = loadChunk(chunkId);
+            loadedChunkIds_.push_back(chunkId);
+        }
+
+        return *chunk;
+    }
+
+    std::unique_ptr<TileStorage::Chunk> TileStorage::loadChunk(std::size_t chunkId) const {
+        auto chunk = std::make_unique<Chunk>();
+
+        for (const auto& rule : collidableRules_)
+            applyRule(rule, chunkId, *chunk);
+
+        return chunk;
+    }
+
+    void TileStorage::copyIds(std::size_t chunkId, Chunk& chunk) const {
+        chunk.ids.assign(CHUNK_TILE_COUNT, '\0');
+
+        const auto firstRow = static_cast<unsigned int>(chunkId / numOfChunkColms_) * CHUNK_SIZE;
+        const auto firstColm = static_cast<unsigned int>(chunkId % numOfChunkColms_) * CHUNK_SIZE;
+        const auto rowCount = std::min(static_cast<unsigned int>(CHUNK_SIZE), numOfRows_ - firstRow);
+        const auto colmCount = std::min(static_cast<unsigned int>(CHUNK_SIZE), numOfColms_ - firstColm);
+
+        for (auto i = 0u; i < rowCount; i++) {
+            const char* tile = file_.getData() + getRowOffset(firstRow + i) + firstColm * tileStride_;
+            char* ids = chunk.ids.data() + i * CHUNK_SIZE;
+
+            if (tileStride_ == 1)
+                std::memcpy(ids, tile, colmCount);
+            else {
+                for (auto j = 0u; j < colmCount; j++, tile += tileStride_)
+                    ids[j] = *tile;
+            }
+        }
+    }
+
+    char TileStorage::getId(const Chunk &chunk, const Index &index) const {
+        if (!chunk.ids.empty())
+            return chunk.ids[getOffsetInChunk(index)];
+
+        return file_.getData()[getRowOffset(static_cast<unsigned int>(index.row)) + static_cast<std::size_t>(index.colm) * tileStride_];
+    }
+
+    std::size_t TileStorage::getRowOffset(unsigned int row) const {
+        if (isBinary_)
+            return GridParser::BINARY_HEADER_SIZE + static_cast<std::size_t>(row) * numOfColms_;
+
+        return rowOffsets_[row];
+    }
+
+    void TileStorage::applyRule(const CollidableRule& rule, std::size_t chunkId, Chunk& chunk) const {
+        const auto firstRow = static_cast<unsigned int>(chunkId / numOfChunkColms_) * CHUNK_SIZE;
+        const auto firstColm = static_cast<unsigned int>(chunkId % numOfChunkColms_) * CHUNK_SIZE;
+        const auto rowCount = std::min(static_cast<unsigned int>(CHUNK_SIZE), numOfRows_ - firstRow);
+        const auto colmCount = std::min(static_cast<unsigned int>(CHUNK_SIZE), numOfColms_ - firstColm);
+
+        // The ids are read from the file if they were not copied into the chunk
+        const bool isCopied = !chunk.ids.empty();
+        const std::size_t stride = isCopied ? 1 : tileStride_;
+
+        for (auto i = 0u; i < rowCount; i++) {
+            const char* tile = isCopied ? chunk.ids.data() + i * CHUNK_SIZE
+                : file_.getData() + getRowOffset(firstRow + i) + firstColm * tileStride_;
+
+            for (auto j = 0u; j < colmCount; j++, tile += stride) {
+                if ((*tile == rule.id) == rule.isExclusion)
+                    continue;
+
+                if (chunk.collidableFlags.empty()) {
+                    if (!rule.isCollidable)
+                        continue;
+
+                    chunk.collidableFlags.assign(CHUNK_TILE_COUNT, 0);
+                }
+
+                chunk.collidableFlags[i * CHUNK_SIZE + j] = static_cast<Uint8>(rule.isCollidable);
+            }
+        }
+    }
+
+    std::size_t TileStorage::getOffsetInChunk(const Index &index) {
+        return static_cast<std::size_t>(static_cast<unsigned int>(index.row) % CHUNK_SIZE) * CHUNK_SIZE +
+            static_cast<unsigned int>(index.colm) % CHUNK_SIZE;
+    }
+}
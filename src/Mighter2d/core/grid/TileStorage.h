@@ -0,0 +1,299 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_TILESTORAGE_H
+#define MIGHTER2D_TILESTORAGE_H
+
+#include "Mighter2d/Config.h"
+#include "Mighter2d/core/grid/Index.h"
+#include "Mighter2d/utility/MemoryMappedFile.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mighter2d::priv {
+    /**
+     * @brief Stores the data of the tiles of a Grid in fixed-size chunks
+     *
+     * The storage either keeps every chunk in memory or reads the chunks
+     * on demand from a memory-mapped map file. The ids of a chunk that is
+     * read from a file are read straight from the mapping until one of them
+     * is modified, at which point they are copied into the chunk. A streamed
+     * storage also evicts the chunks that are far from every focus point.
+     * Chunks whose tiles were modified individually are never evicted, so
+     * modifications are not lost
+     *
+     * All functions taking an Index expect it to be within bounds
+     */
+    class TileStorage {
+    public:
+        static constexpr int CHUNK_SIZE = 32; //!< The number of tiles along each side of a chunk
+
+        /**
+         * @brief Default constructor
+         *
+         * The storage has no tiles
+         */
+        TileStorage();
+
+        /**
+         * @brief Copy constructor
+         */
+        TileStorage(const TileStorage&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        TileStorage& operator=(const TileStorage&) = delete;
+
+        /**
+         * @brief Create tiles that are kept in memory
+         * @param rows The number of rows
+         * @param colms The number of columns
+         * @param id The id of each tile
+         */
+        void create(unsigned int rows, unsigned int colms, char id);
+
+        /**
+         * @brief Read the tiles from a map file on demand
+         * @param filename Name of the file that contains the map data
+         * @param separator Character used to separate map data in a text file
+         * @param isStreamed True to evict the chunks that are far from every
+         *                   focus point, or false to keep loaded chunks
+         * @throws FileNotFoundException If @a filename cannot be opened for reading
+         * @throws InvalidParseException If the contents of @a filename cannot
+         *         be read on demand
+         *
+         * The file is either a binary map file (see GridParser) or a text
+         * file with the format accepted by GridParser, except that all the
+         * rows must have the same number of tiles and, when a separator is
+         * used, exactly one separator between tiles. These restrictions make
+         * the position of every tile in the file known without parsing the
+         * rows that precede it. Only the text format requires a pass over
+         * the file to find the rows
+         */
+        void open(const std::string& filename, char separator, bool isStreamed);
+
+        /**
+         * @brief Check if the tiles are streamed from a file or not
+         * @return True if chunks are evicted, otherwise false
+         */
+        bool isStreamed() const;
+
+        /**
+         * @brief Get the number of rows
+         * @return The number of rows
+         */
+        unsigned int getRowCount() const;
+
+        /**
+         * @brief Get the number of columns
+         * @return The number of columns
+         */
+        unsigned int getColumnCount() const;
+
+        /**
+         * @brief Set the id of a tile
+         * @param index The index of the tile
+         * @param id The new id of the tile
+         */
+        void setId(const Index& index, char id);
+
+        /**
+         * @brief Get the id of a tile
+         * @param index The index of the tile
+         * @return The id of the tile
+         */
+        char getId(const Index& index) const;
+
+        /**
+         * @brief Set whether or not a tile is collidable
+         * @param index The index of the tile
+         * @param isCollidable True to set collidable, otherwise false
+         */
+        void setCollidable(const Index& index, bool isCollidable);
+
+        /**
+         * @brief Check if a tile is collidable or not
+         * @param index The index of the tile
+         * @return True if the tile is collidable, otherwise false
+         */
+        bool isCollidable(const Index& index) const;
+
+        /**
+         * @brief Set whether or not the tiles with a certain id are collidable
+         * @param id The id of the tiles
+         * @param isExclusion True to update the tiles whose id is not @a id instead
+         * @param isCollidable True to set collidable, otherwise false
+         *
+         * In streaming mode, the change is also applied to the chunks that
+         * are loaded later on
+         */
+        void setCollidableById(char id, bool isExclusion, bool isCollidable);
+
+        /**
+         * @brief Set the user bits of a tile
+         * @param index The index of the tile
+         * @param bits The user bits of the tile
+         */
+        void setUserBits(const Index& index, Uint32 bits);
+
+        /**
+         * @brief Get the user bits of a tile
+         * @param index The index of the tile
+         * @return The user bits of the tile
+         */
+        Uint32 getUserBits(const Index& index) const;
+
+        /**
+         * @brief Load the chunks around focus points and evict the others
+         * @param focusPoints The tiles around which chunks are kept in memory
+         * @param radius The number of chunks kept around the chunk of a focus point
+         *
+         * The focus points may lie outside the grid. A chunk is evicted
+         * once it is more than @a radius + 1 chunks away from every focus
+         * point, so that a focus point moving back and forth across a chunk
+         * border does not reload the same chunks repeatedly
+         *
+         * This function has no effect if the tiles are not streamed
+         */
+        void setFocusPoints(const std::vector<Index>& focusPoints, unsigned int radius);
+
+        /**
+         * @brief Get the number of chunks in memory
+         * @return The number of chunks in memory
+         */
+        std::size_t getLoadedChunkCount() const;
+
+    private:
+        /**
+         * @brief A square block of tiles
+         */
+        struct Chunk {
+            std::vector<char> ids;                //!< The id of each tile, empty while the ids are read from the file
+            std::vector<Uint8> collidableFlags;   //!< The collision flag of each tile, empty if none is collidable
+            std::vector<Uint32> userBits;         //!< The user bits of each tile, empty if all are 0
+            bool isModified = false;              //!< A flag indicating whether or not a tile was modified individually
+        };
+
+        /**
+         * @brief A collision change applied to tiles by id
+         */
+        struct CollidableRule {
+            char id;              //!< The id of the tiles
+            bool isExclusion;     //!< True if the rule applies to the tiles without the id
+            bool isCollidable;    //!< The collision flag of the tiles
+        };
+
+        /**
+         * @brief Reset the storage
+         * @param rows The number of rows
+         * @param colms The number of columns
+         */
+        void reset(unsigned int rows, unsigned int colms);
+
+        /**
+         * @brief Find the rows of a text map file
+         * @param filename Name of the file, used in error messages
+         * @param separator Character used to separate map data
+         * @throws InvalidParseException If the rows cannot be read on demand
+         */
+        void indexRows(const std::string& filename, char separator);
+
+        /**
+         * @brief Get the position of a row in the map file
+         * @param row The row
+         * @return The position of the first tile of the row in the map file
+         */
+        std::size_t getRowOffset(unsigned int row) const;
+
+        /**
+         * @brief Get the position of the chunk containing a tile
+         * @param index The index of the tile
+         * @return The row-major position of the chunk
+         */
+        std::size_t getChunkId(const Index& index) const;
+
+        /**
+         * @brief Get the chunk containing a tile, loading it if needed
+         * @param index The index of the tile
+         * @return The chunk containing the tile
+         */
+        Chunk& getChunk(const Index& index) const;
+
+        /**
+         * @brief Load a chunk from the map file
+         * @param chunkId The position of the chunk
+         * @return The loaded chunk
+         *
+         * The ids of the chunk are not copied, see copyIds
+         */
+        std::unique_ptr<Chunk> loadChunk(std::size_t chunkId) const;
+
+        /**
+         * @brief Copy the ids of a chunk out of the map file
+         * @param chunkId The position of the chunk
+         * @param chunk The chunk whose ids are read from the file
+         */
+        void copyIds(std::size_t chunkId, Chunk& chunk) const;
+
+        /**
+         * @brief Get the id of a tile of a chunk
+         * @param chunk The chunk containing the tile
+         * @param index The index of the tile
+         * @return The id of the tile
+         */
+        char getId(const Chunk& chunk, const Index& index) const;
+
+        /**
+         * @brief Apply a collision rule to a chunk
+         * @param rule The rule to be applied
+         * @param chunkId The position of the chunk
+         * @param chunk The chunk to apply the rule to
+         */
+        void applyRule(const CollidableRule& rule, std::size_t chunkId, Chunk& chunk) const;
+
+        /**
+         * @brief Get the position of a tile within its chunk
+         * @param index The index of the tile
+         * @return The position of the tile within its chunk
+         */
+        static std::size_t getOffsetInChunk(const Index& index);
+
+    private:
+        unsigned int numOfRows_;                             //!< The number of rows
+        unsigned int numOfColms_;                            //!< The number of columns
+        unsigned int numOfChunkColms_;                       //!< The number of chunk columns
+        mutable std::vector<std::unique_ptr<Chunk>> chunks_; //!< Chunks (row-major), nullptr if not in memory
+        mutable std::vector<std::size_t> loadedChunkIds_;    //!< The position of the chunks in memory
+        MemoryMappedFile file_;                              //!< The file the chunks are read from
+        std::vector<std::size_t> rowOffsets_;                //!< The position of each row in a text file
+        std::size_t tileStride_;                             //!< The distance between two tiles of a row in the file
+        bool isBinary_;                                      //!< A flag indicating whether or not the file is a binary map file
+        bool isStreamed_;                                    //!< A flag indicating whether or not chunks are evicted
+        std::vector<CollidableRule> collidableRules_;        //!< Collision changes applied to the chunks loaded later on
+    };
+}
+
+#endif
@@ -23,17 +23,57 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Mighter2d/core/object/CollisionExcludeList.h"
+#include "Mighter2d/core/physics/Collidable.h"
+#include "Mighter2d/core/physics/CollisionGroupRegistry.h"
 
 namespace mighter2d {
+    CollisionExcludeList::CollisionExcludeList() :
+        registry_{nullptr},
+        mask_{0},
+        isMaskComplete_{true},
+        owner_{nullptr}
+    {}
+
+    CollisionExcludeList::CollisionExcludeList(const CollisionExcludeList &other) :
+        list_{other.list_},
+        registry_{other.registry_},
+        mask_{other.mask_},
+        isMaskComplete_{other.isMaskComplete_},
+        owner_{nullptr}
+    {}
+
+    CollisionExcludeList &CollisionExcludeList::operator=(const CollisionExcludeList &other) {
+        if (this != &other) {
+            list_ = other.list_;
+            registry_ = other.registry_;
+            mask_ = other.mask_;
+            isMaskComplete_ = other.isMaskComplete_;
+            notifyOwner();
+        }
+
+        return *this;
+    }
+
     void CollisionExcludeList::add(const std::string &group) {
-        list_.insert(group);
+        if (list_.insert(group).second) {
+            std::uint64_t bit = registry_ ? registry_->getBit(group) : 0;
+            mask_ |= bit;
+            isMaskComplete_ = isMaskComplete_ && bit != 0;
+            notifyOwner();
+        }
     }
 
     bool CollisionExcludeList::remove(const std::string &group) {
-        return list_.erase(group);
+        if (list_.erase(group)) {
+            updateMask();
+            notifyOwner();
+            return true;
+        }
+
+        return false;
     }
 
-    bool CollisionExcludeList::contains(const std::string &group) {
+    bool CollisionExcludeList::contains(const std::string &group) const {
         return list_.find(group) != list_.end();
     }
 
@@ -42,7 +82,39 @@ namespace mighter2d {
     }
 
     void CollisionExcludeList::clear() {
+        if (list_.empty())
+            return;
+
         list_.clear();
+        mask_ = 0;
+        isMaskComplete_ = true;
+        notifyOwner();
     }
-}
 
+    void CollisionExcludeList::setGroupRegistry(priv::CollisionGroupRegistry *registry) {
+        if (registry_ != registry) {
+            registry_ = registry;
+            updateMask();
+        }
+    }
+
+    void CollisionExcludeList::setOwner(Collidable *owner) {
+        owner_ = owner;
+    }
+
+    void CollisionExcludeList::updateMask() {
+        mask_ = 0;
+        isMaskComplete_ = true;
+
+        for (const auto& group : list_) {
+            std::uint64_t bit = registry_ ? registry_->getBit(group) : 0;
+            mask_ |= bit;
+            isMaskComplete_ = isMaskComplete_ && bit != 0;
+        }
+    }
+
+    void CollisionExcludeList::notifyOwner() {
+        if (owner_)
+            owner_->notifyCollisionFilterChange();
+    }
+}
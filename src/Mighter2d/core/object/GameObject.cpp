@@ -33,6 +33,7 @@ namespace mighter2d {
         isActive_{true},
         sprite_(std::make_unique<Sprite>(scene))
     {
+        updateBoundingBox();
         initEvents();
     }
 
@@ -42,7 +43,8 @@ namespace mighter2d {
         state_{other.state_},
         isActive_{other.isActive_},
         transform_{other.transform_},
-        sprite_{std::make_unique<Sprite>(*other.sprite_)}
+        sprite_{std::make_unique<Sprite>(*other.sprite_)},
+        boundingBox_{other.boundingBox_}
     {
         initEvents();
     }
@@ -81,6 +83,7 @@ namespace mighter2d {
         std::swap(transform_, other.transform_);
         std::swap(sprite_, other.sprite_);
         std::swap(userData_, other.userData_);
+        std::swap(boundingBox_, other.boundingBox_);
     }
 
     GameObject::Ptr GameObject::create(Scene &scene) {
@@ -160,11 +163,22 @@ namespace mighter2d {
         return *sprite_;
     }
 
+    const BoundingBox &GameObject::getBoundingBox() const {
+        return boundingBox_;
+    }
+
+    void GameObject::updateBoundingBox() {
+        boundingBox_ = BoundingBox(transform_.getPosition(), sprite_->getGlobalBounds().getSize());
+        emitChange(Property{"boundingBox", boundingBox_});
+    }
+
     void GameObject::initEvents() {
         // Always keep the game object origin at the centre of sprite
         sprite_->onPropertyChange([this](const Property& property) {
-            if (property.getName() == "scale" || property.getName() == "texture" || property.getName() == "textureRect")
+            if (property.getName() == "scale" || property.getName() == "texture" || property.getName() == "textureRect") {
                 resetSpriteOrigin();
+                updateBoundingBox();
+            }
         });
 
         // Keep the sprite in sync with the objects transfor changes
@@ -172,15 +186,19 @@ namespace mighter2d {
             const auto& name = property.getName();
             if (name == "position") {
                 sprite_->setPosition(transform_.getPosition());
+                updateBoundingBox();
                 emitChange(Property{name, transform_.getPosition()});
             } else if (name == "origin") {
                 sprite_->setOrigin(transform_.getOrigin());
+                updateBoundingBox();
                 emitChange(Property{name, transform_.getOrigin()});
             } else if (name == "scale") {
                 sprite_->setScale(transform_.getScale());
+                updateBoundingBox();
                 emitChange(Property{name, transform_.getScale()});
             } else if (name == "rotation") {
                 sprite_->setRotation(transform_.getRotation());
+                updateBoundingBox();
                 emitChange(Property{name, transform_.getRotation()});
             }
         });
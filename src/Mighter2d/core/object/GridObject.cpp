@@ -34,8 +34,11 @@ namespace mighter2d {
         grid_{nullptr},
         isObstacle_{false},
         direction_{0, 0},
-        gridMover_{nullptr}
-    {}
+        gridMover_{nullptr},
+        propertyChangeListenerId_{-1}
+    {
+        initEvents();
+    }
 
     GridObject::GridObject(const GridObject& other) :
         GameObject(other),
@@ -43,8 +46,11 @@ namespace mighter2d {
         grid_{other.grid_},
         isObstacle_{other.isObstacle_},
         direction_{other.direction_},
-        gridMover_{nullptr}
-    {}
+        gridMover_{nullptr},
+        propertyChangeListenerId_{other.propertyChangeListenerId_}
+    {
+        initEvents();
+    }
 
     GridObject &GridObject::operator=(const GridObject& rhs) {
         if (this != &rhs) {
@@ -53,6 +59,7 @@ namespace mighter2d {
             Collidable::operator=(temp);
             swap(temp);
             gridMover_ = nullptr;
+            initEvents();
         }
 
         return *this;
@@ -64,6 +71,7 @@ namespace mighter2d {
         std::swap(direction_, other.direction_);
         std::swap(obstacleColFilter_, other.obstacleColFilter_);
         std::swap(gridMover_, other.gridMover_);
+        std::swap(propertyChangeListenerId_, other.propertyChangeListenerId_);
     }
 
     std::string GridObject::getClassName() const {
@@ -71,7 +79,7 @@ namespace mighter2d {
     }
 
     const BoundingBox &GridObject::getBoundingBox() const {
-        return BoundingBox(getTransform().getPosition(), getSprite().getGlobalBounds().getSize());
+        return GameObject::getBoundingBox();
     }
 
     GridObject::Ptr GridObject::create(Scene &scene) {
@@ -208,6 +216,17 @@ namespace mighter2d {
         }
     }
 
+    void GridObject::initEvents() {
+        // A copy inherits the listener of the object it was copied from
+        removeEventListener(propertyChangeListenerId_);
+
+        // Also covers the changes made directly to the sprite, such as its scale or texture rectangle
+        propertyChangeListenerId_ = onPropertyChange([this](const Property& property) {
+            if (property.getName() == "boundingBox")
+                notifyBoundingBoxChange();
+        });
+    }
+
     void GridObject::emitGridEvent(const Property& property) {
         if ((property.getName() == "borderCollision") ||
             (property.getName() == "moveBegin") ||
@@ -0,0 +1,379 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/physics/AABBTree.h"
+#include "Mighter2d/Config.h"
+#include <algorithm>
+#include <cmath>
+
+namespace mighter2d::priv {
+    namespace {
+        constexpr int NULL_NODE = -1;
+    }
+
+    bool AABB::contains(const AABB& other) const {
+        return min.x <= other.min.x && min.y <= other.min.y && other.max.x <= max.x && other.max.y <= max.y;
+    }
+
+    bool AABB::overlaps(const AABB& other) const {
+        return min.x <= other.max.x && other.min.x <= max.x && min.y <= other.max.y && other.min.y <= max.y;
+    }
+
+    float AABB::getPerimeter() const {
+        return 2.0f * ((max.x - min.x) + (max.y - min.y));
+    }
+
+    AABB AABB::merge(const AABB& a, const AABB& b) {
+        return AABB{{std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y)},
+                    {std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y)}};
+    }
+
+    AABBTree::AABBTree(float margin) :
+        margin_{margin},
+        root_{NULL_NODE},
+        freeList_{NULL_NODE},
+        proxyCount_{0}
+    {}
+
+    int AABBTree::createProxy(const AABB& aabb, int userData) {
+        int proxyId = allocateNode();
+        Node& node = nodes_[proxyId];
+        node.aabb = AABB{{aabb.min.x - margin_, aabb.min.y - margin_}, {aabb.max.x + margin_, aabb.max.y + margin_}};
+        node.userData = userData;
+        node.height = 0;
+
+        insertLeaf(proxyId);
+        proxyCount_++;
+
+        return proxyId;
+    }
+
+    void AABBTree::destroyProxy(int proxyId) {
+        MIGHTER2D_ASSERT(proxyId >= 0 && proxyId < static_cast<int>(nodes_.size()) && nodes_[proxyId].isLeaf(), "Invalid AABB tree proxy")
+
+        removeLeaf(proxyId);
+        freeNode(proxyId);
+        proxyCount_--;
+    }
+
+    bool AABBTree::moveProxy(int proxyId, const AABB& aabb) {
+        MIGHTER2D_ASSERT(proxyId >= 0 && proxyId < static_cast<int>(nodes_.size()) && nodes_[proxyId].isLeaf(), "Invalid AABB tree proxy")
+
+        if (nodes_[proxyId].aabb.contains(aabb))
+            return false;
+
+        removeLeaf(proxyId);
+        nodes_[proxyId].aabb = AABB{{aabb.min.x - margin_, aabb.min.y - margin_}, {aabb.max.x + margin_, aabb.max.y + margin_}};
+        insertLeaf(proxyId);
+
+        return true;
+    }
+
+    int AABBTree::getUserData(int proxyId) const {
+        return nodes_[proxyId].userData;
+    }
+
+    const AABB& AABBTree::getFatAABB(int proxyId) const {
+        return nodes_[proxyId].aabb;
+    }
+
+    void AABBTree::query(const AABB& aabb, const std::function<void(int)>& callback) const {
+        if (root_ == NULL_NODE)
+            return;
+
+        std::vector<int> stack;
+        stack.reserve(64);
+        stack.push_back(root_);
+
+        while (!stack.empty()) {
+            const Node& node = nodes_[stack.back()];
+            stack.pop_back();
+
+            if (!node.aabb.overlaps(aabb))
+                continue;
+
+            if (node.isLeaf())
+                callback(node.userData);
+            else {
+                stack.push_back(node.child1);
+                stack.push_back(node.child2);
+            }
+        }
+    }
+
+    void AABBTree::rayCast(const Vector2f& from, const Vector2f& to, const std::function<void(int)>& callback) const {
+        if (root_ == NULL_NODE)
+            return;
+
+        const Vector2f delta = to - from;
+        const AABB segmentBounds = AABB::merge(AABB{from, from}, AABB{to, to});
+
+        // Slab test of the segment against a box
+        auto isCrossed = [&from, &delta](const AABB& aabb) {
+            float tMin = 0.0f, tMax = 1.0f;
+            const float origin[2] = {from.x, from.y};
+            const float direction[2] = {delta.x, delta.y};
+            const float lower[2] = {aabb.min.x, aabb.min.y};
+            const float upper[2] = {aabb.max.x, aabb.max.y};
+
+            for (int axis = 0; axis < 2; axis++) {
+                if (direction[axis] == 0.0f) {
+                    if (origin[axis] < lower[axis] || origin[axis] > upper[axis])
+                        return false;
+                } else {
+                    float t1 = (lower[axis] - origin[axis]) / direction[axis];
+                    float t2 = (upper[axis] - origin[axis]) / direction[axis];
+
+                    tMin = std::max(tMin, std::min(t1, t2));
+                    tMax = std::min(tMax, std::max(t1, t2));
+
+                    if (tMin > tMax)
+                        return false;
+                }
+            }
+
+            return true;
+        };
+
+        std::vector<int> stack;
+        stack.reserve(64);
+        stack.push_back(root_);
+
+        while (!stack.empty()) {
+            const Node& node = nodes_[stack.back()];
+            stack.pop_back();
+
+            if (!node.aabb.overlaps(segmentBounds) || !isCrossed(node.aabb))
+                continue;
+
+            if (node.isLeaf())
+                callback(node.userData);
+            else {
+                stack.push_back(node.child1);
+                stack.push_back(node.child2);
+            }
+        }
+    }
+
+    int AABBTree::getHeight() const {
+        return root_ == NULL_NODE ? 0 : nodes_[root_].height;
+    }
+
+    std::size_t AABBTree::getProxyCount() const {
+        return proxyCount_;
+    }
+
+    void AABBTree::clear() {
+        nodes_.clear();
+        root_ = freeList_ = NULL_NODE;
+        proxyCount_ = 0;
+    }
+
+    int AABBTree::allocateNode() {
+        int nodeId;
+
+        if (freeList_ == NULL_NODE) {
+            nodeId = static_cast<int>(nodes_.size());
+            nodes_.emplace_back();
+        } else {
+            nodeId = freeList_;
+            freeList_ = nodes_[nodeId].parent;
+        }
+
+        Node& node = nodes_[nodeId];
+        node.parent = node.child1 = node.child2 = NULL_NODE;
+        node.height = 0;
+        node.userData = -1;
+
+        return nodeId;
+    }
+
+    void AABBTree::freeNode(int nodeId) {
+        nodes_[nodeId].parent = freeList_;
+        nodes_[nodeId].height = -1;
+        freeList_ = nodeId;
+    }
+
+    void AABBTree::insertLeaf(int leaf) {
+        if (root_ == NULL_NODE) {
+            root_ = leaf;
+            nodes_[root_].parent = NULL_NODE;
+            return;
+        }
+
+        // Find the best sibling for the leaf (surface area heuristic)
+        const AABB leafAABB = nodes_[leaf].aabb;
+        int index = root_;
+
+        while (!nodes_[index].isLeaf()) {
+            const Node& node = nodes_[index];
+            float area = node.aabb.getPerimeter();
+            float combinedArea = AABB::merge(node.aabb, leafAABB).getPerimeter();
+
+            // Cost of creating a new parent for this node and the new leaf
+            float cost = 2.0f * combinedArea;
+
+            // Minimum cost of pushing the leaf further down the tree
+            float inheritanceCost = 2.0f * (combinedArea - area);
+
+            auto getDescendCost = [&](int child) {
+                const AABB merged = AABB::merge(leafAABB, nodes_[child].aabb);
+
+                if (nodes_[child].isLeaf())
+                    return merged.getPerimeter() + inheritanceCost;
+                else
+                    return (merged.getPerimeter() - nodes_[child].aabb.getPerimeter()) + inheritanceCost;
+            };
+
+            float cost1 = getDescendCost(node.child1);
+            float cost2 = getDescendCost(node.child2);
+
+            if (cost < cost1 && cost < cost2)
+                break;
+
+            index = cost1 < cost2 ? node.child1 : node.child2;
+        }
+
+        // Create a new parent for the sibling and the leaf
+        int sibling = index;
+        int oldParent = nodes_[sibling].parent;
+        int newParent = allocateNode();
+        nodes_[newParent].parent = oldParent;
+        nodes_[newParent].aabb = AABB::merge(leafAABB, nodes_[sibling].aabb);
+        nodes_[newParent].height = nodes_[sibling].height + 1;
+        nodes_[newParent].child1 = sibling;
+        nodes_[newParent].child2 = leaf;
+        nodes_[sibling].parent = newParent;
+        nodes_[leaf].parent = newParent;
+
+        if (oldParent == NULL_NODE)
+            root_ = newParent;
+        else if (nodes_[oldParent].child1 == sibling)
+            nodes_[oldParent].child1 = newParent;
+        else
+            nodes_[oldParent].child2 = newParent;
+
+        refitAncestors(nodes_[leaf].parent);
+    }
+
+    void AABBTree::removeLeaf(int leaf) {
+        if (leaf == root_) {
+            root_ = NULL_NODE;
+            return;
+        }
+
+        int parent = nodes_[leaf].parent;
+        int grandParent = nodes_[parent].parent;
+        int sibling = nodes_[parent].child1 == leaf ? nodes_[parent].child2 : nodes_[parent].child1;
+
+        if (grandParent == NULL_NODE) {
+            root_ = sibling;
+            nodes_[sibling].parent = NULL_NODE;
+            freeNode(parent);
+            return;
+        }
+
+        // Replace the parent with the sibling
+        if (nodes_[grandParent].child1 == parent)
+            nodes_[grandParent].child1 = sibling;
+        else
+            nodes_[grandParent].child2 = sibling;
+
+        nodes_[sibling].parent = grandParent;
+        freeNode(parent);
+
+        refitAncestors(grandParent);
+    }
+
+    void AABBTree::refitAncestors(int nodeId) {
+        int index = nodeId;
+
+        while (index != NULL_NODE) {
+            index = balance(index);
+
+            Node& node = nodes_[index];
+            node.height = 1 + std::max(nodes_[node.child1].height, nodes_[node.child2].height);
+            node.aabb = AABB::merge(nodes_[node.child1].aabb, nodes_[node.child2].aabb);
+
+            index = node.parent;
+        }
+    }
+
+    int AABBTree::balance(int nodeA) {
+        Node& a = nodes_[nodeA];
+
+        if (a.isLeaf() || a.height < 2)
+            return nodeA;
+
+        int nodeB = a.child1;
+        int nodeC = a.child2;
+        int heightDiff = nodes_[nodeC].height - nodes_[nodeB].height;
+
+        // Rotate the taller child up
+        auto rotate = [this, nodeA](int up, int other) {
+            Node& nodeUp = nodes_[up];
+            int f = nodeUp.child1;
+            int g = nodeUp.child2;
+
+            // Swap A and the child being rotated up
+            nodeUp.child1 = nodeA;
+            nodeUp.parent = nodes_[nodeA].parent;
+            nodes_[nodeA].parent = up;
+
+            if (nodeUp.parent == NULL_NODE)
+                root_ = up;
+            else if (nodes_[nodeUp.parent].child1 == nodeA)
+                nodes_[nodeUp.parent].child1 = up;
+            else
+                nodes_[nodeUp.parent].child2 = up;
+
+            // The taller grandchild stays with the rotated node, the other one moves to A
+            if (nodes_[f].height < nodes_[g].height)
+                std::swap(f, g);
+
+            nodeUp.child2 = f;
+            nodes_[g].parent = nodeA;
+
+            if (nodes_[nodeA].child1 == up)
+                nodes_[nodeA].child1 = g;
+            else
+                nodes_[nodeA].child2 = g;
+
+            nodes_[nodeA].aabb = AABB::merge(nodes_[other].aabb, nodes_[g].aabb);
+            nodes_[nodeA].height = 1 + std::max(nodes_[other].height, nodes_[g].height);
+            nodeUp.aabb = AABB::merge(nodes_[nodeA].aabb, nodes_[f].aabb);
+            nodeUp.height = 1 + std::max(nodes_[nodeA].height, nodes_[f].height);
+
+            return up;
+        };
+
+        if (heightDiff > 1)
+            return rotate(nodeC, nodeB);
+
+        if (heightDiff < -1)
+            return rotate(nodeB, nodeC);
+
+        return nodeA;
+    }
+}
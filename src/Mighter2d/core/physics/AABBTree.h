@@ -0,0 +1,210 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_AABBTREE_H
+#define MIGHTER2D_AABBTREE_H
+
+#include "Mighter2d/common/Vector2.h"
+#include <functional>
+#include <vector>
+
+namespace mighter2d::priv {
+    /**
+     * @brief Axis aligned bounding box
+     */
+    struct AABB {
+        Vector2f min; //!< Top left corner
+        Vector2f max; //!< Bottom right corner
+
+        /**
+         * @brief Check if this box fully contains another box
+         * @param other The box to be checked
+         * @return True if @a other is inside this box, otherwise false
+         */
+        bool contains(const AABB& other) const;
+
+        /**
+         * @brief Check if this box overlaps another box
+         * @param other The box to be checked
+         * @return True if the boxes overlap or touch, otherwise false
+         */
+        bool overlaps(const AABB& other) const;
+
+        /**
+         * @brief Get the perimeter of the box
+         * @return The perimeter of the box
+         */
+        float getPerimeter() const;
+
+        /**
+         * @brief Get the smallest box that contains two boxes
+         * @param a The first box
+         * @param b The second box
+         * @return The union of @a a and @a b
+         */
+        static AABB merge(const AABB& a, const AABB& b);
+    };
+
+    /**
+     * @brief Dynamic bounding volume hierarchy
+     *
+     * Each proxy is stored in a leaf with a "fat" AABB, that is, the
+     * AABB of the proxy enlarged by a margin. A proxy whose AABB moves
+     * within its fat AABB does not need to be touched, only proxies that
+     * escape their fat AABB are reinserted into the tree. The tree is
+     * kept balanced using rotations (the same way an AVL tree is)
+     */
+    class AABBTree {
+    public:
+        /**
+         * @brief Constructor
+         * @param margin The amount by which the AABB of a proxy is enlarged on each side
+         */
+        explicit AABBTree(float margin = 8.0f);
+
+        /**
+         * @brief Add a proxy to the tree
+         * @param aabb The AABB of the proxy
+         * @param userData The data to be associated with the proxy
+         * @return The id of the proxy
+         */
+        int createProxy(const AABB& aabb, int userData);
+
+        /**
+         * @brief Remove a proxy from the tree
+         * @param proxyId The id of the proxy to be removed
+         */
+        void destroyProxy(int proxyId);
+
+        /**
+         * @brief Update the AABB of a proxy
+         * @param proxyId The id of the proxy
+         * @param aabb The new AABB of the proxy
+         * @return True if the proxy was reinserted, or false if @a aabb
+         *         is still inside the fat AABB of the proxy
+         */
+        bool moveProxy(int proxyId, const AABB& aabb);
+
+        /**
+         * @brief Get the data associated with a proxy
+         * @param proxyId The id of the proxy
+         * @return The data associated with the proxy
+         */
+        int getUserData(int proxyId) const;
+
+        /**
+         * @brief Get the fat AABB of a proxy
+         * @param proxyId The id of the proxy
+         * @return The fat AABB of the proxy
+         */
+        const AABB& getFatAABB(int proxyId) const;
+
+        /**
+         * @brief Find all the proxies whose fat AABB overlaps a box
+         * @param aabb The box to be tested
+         * @param callback Function called with the user data of every overlapping proxy
+         */
+        void query(const AABB& aabb, const std::function<void(int)>& callback) const;
+
+        /**
+         * @brief Find all the proxies whose fat AABB is crossed by a line segment
+         * @param from The start point of the segment
+         * @param to The end point of the segment
+         * @param callback Function called with the user data of every crossed proxy
+         */
+        void rayCast(const Vector2f& from, const Vector2f& to, const std::function<void(int)>& callback) const;
+
+        /**
+         * @brief Get the height of the tree
+         * @return The height of the tree, 0 if it is empty or has one proxy
+         */
+        int getHeight() const;
+
+        /**
+         * @brief Get the number of proxies in the tree
+         * @return The number of proxies
+         */
+        std::size_t getProxyCount() const;
+
+        /**
+         * @brief Remove all the proxies
+         */
+        void clear();
+
+    private:
+        /**
+         * @brief Tree node
+         */
+        struct Node {
+            AABB aabb;      //!< Fat AABB for leaves, union of the children for branches
+            int parent;     //!< Parent node, or the next free node when the node is not in use
+            int child1;     //!< First child, -1 for leaves
+            int child2;     //!< Second child, -1 for leaves
+            int height;     //!< 0 for leaves, -1 for free nodes
+            int userData;   //!< Proxy data (leaves only)
+
+            bool isLeaf() const { return child1 == -1; }
+        };
+
+        /**
+         * @brief Helper function for getting a node from the pool
+         */
+        int allocateNode();
+
+        /**
+         * @brief Helper function for returning a node to the pool
+         */
+        void freeNode(int nodeId);
+
+        /**
+         * @brief Helper function for inserting a leaf into the tree
+         */
+        void insertLeaf(int leaf);
+
+        /**
+         * @brief Helper function for removing a leaf from the tree
+         */
+        void removeLeaf(int leaf);
+
+        /**
+         * @brief Helper function for rebalancing the subtree rooted at a node
+         * @return The new root of the subtree
+         */
+        int balance(int nodeId);
+
+        /**
+         * @brief Helper function for recomputing the AABBs and heights up to the root
+         */
+        void refitAncestors(int nodeId);
+
+    private:
+        float margin_;            //!< Fat AABB margin
+        int root_;                //!< Root node, -1 if the tree is empty
+        int freeList_;            //!< First free node in the pool
+        std::size_t proxyCount_;  //!< Number of leaves
+        std::vector<Node> nodes_; //!< Node pool
+    };
+}
+
+#endif
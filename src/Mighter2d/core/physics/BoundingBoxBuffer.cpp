@@ -0,0 +1,67 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/physics/BoundingBoxBuffer.h"
+
+namespace mighter2d::priv {
+    void BoundingBoxBuffer::resize(std::size_t size) {
+        left_.resize(size, 0.0f);
+        top_.resize(size, 0.0f);
+        right_.resize(size, 0.0f);
+        bottom_.resize(size, 0.0f);
+        area_.resize(size, 1.0f);
+    }
+
+    std::size_t BoundingBoxBuffer::getSize() const {
+        return left_.size();
+    }
+
+    void BoundingBoxBuffer::add(const BoundingBox &boundingBox) {
+        resize(getSize() + 1);
+        set(getSize() - 1, boundingBox);
+    }
+
+    void BoundingBoxBuffer::set(std::size_t index, const BoundingBox &boundingBox) {
+        const Vector2f& pos = boundingBox.getPosition();
+        const Vector2f& size = boundingBox.getSize();
+
+        left_[index] = pos.x;
+        top_[index] = pos.y;
+        right_[index] = pos.x + size.x;
+        bottom_[index] = pos.y + size.y;
+        area_[index] = (size.x + 1) * (size.y + 1);
+    }
+
+    BoundingBox BoundingBoxBuffer::get(std::size_t index) const {
+        return BoundingBox({left_[index], top_[index]}, {right_[index] - left_[index], bottom_[index] - top_[index]});
+    }
+
+    void BoundingBoxBuffer::clear() {
+        left_.clear();
+        top_.clear();
+        right_.clear();
+        bottom_.clear();
+        area_.clear();
+    }
+}
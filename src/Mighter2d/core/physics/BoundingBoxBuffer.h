@@ -0,0 +1,100 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_BOUNDINGBOXBUFFER_H
+#define MIGHTER2D_BOUNDINGBOXBUFFER_H
+
+#include "Mighter2d/core/physics/BoundingBox.h"
+#include <vector>
+
+namespace mighter2d::priv {
+    /**
+     * @brief Stores bounding boxes as a structure of arrays
+     *
+     * Each component of the bounding boxes is stored in its own contiguous
+     * array, this allows the collision detector to test many bounding boxes
+     * at once using SIMD instructions. The right and bottom edges as well
+     * as the area are precomputed when a bounding box is stored
+     */
+    class BoundingBoxBuffer {
+    public:
+        /**
+         * @brief Set the number of bounding boxes in the buffer
+         * @param size The new number of bounding boxes
+         *
+         * New bounding boxes are empty and located at (0, 0)
+         */
+        void resize(std::size_t size);
+
+        /**
+         * @brief Get the number of bounding boxes in the buffer
+         * @return The number of bounding boxes
+         */
+        std::size_t getSize() const;
+
+        /**
+         * @brief Append a bounding box to the buffer
+         * @param boundingBox The bounding box to be appended
+         */
+        void add(const BoundingBox& boundingBox);
+
+        /**
+         * @brief Replace a bounding box in the buffer
+         * @param index The index of the bounding box to be replaced
+         * @param boundingBox The new bounding box
+         */
+        void set(std::size_t index, const BoundingBox& boundingBox);
+
+        /**
+         * @brief Get a bounding box from the buffer
+         * @param index The index of the bounding box
+         * @return The bounding box at @a index
+         */
+        BoundingBox get(std::size_t index) const;
+
+        /**
+         * @brief Remove all bounding boxes from the buffer
+         */
+        void clear();
+
+        /**
+         * @brief Get the arrays of the bounding box components
+         * @return A pointer to the first element of the array
+         */
+        const float* getLefts() const { return left_.data(); }
+        const float* getTops() const { return top_.data(); }
+        const float* getRights() const { return right_.data(); }
+        const float* getBottoms() const { return bottom_.data(); }
+        const float* getAreas() const { return area_.data(); }
+
+    private:
+        std::vector<float> left_;   //!< X coordinates of the left edges
+        std::vector<float> top_;    //!< Y coordinates of the top edges
+        std::vector<float> right_;  //!< X coordinates of the right edges
+        std::vector<float> bottom_; //!< Y coordinates of the bottom edges
+        std::vector<float> area_;   //!< Areas used by the IoU computation
+    };
+}
+
+#endif
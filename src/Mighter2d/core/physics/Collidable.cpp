@@ -23,57 +23,50 @@
 // ///////////////////////////////////////////////////////////////////////////
 
 #include "Mighter2d/core/physics/Collidable.h"
-#include "Mighter2d/core/physics/CollisionDetector.h"
+#include "Mighter2d/core/physics/CollisionGroupRegistry.h"
 #include "Mighter2d/core/scene/Scene.h"
 
 namespace mighter2d {
-    namespace {
-        bool canCollide(Collidable& colA, Collidable& colB) {
-            // Prevent Self collision
-            if (&colA == &colB)
-                return false;
-
-            // Collision disabled
-            if (!(colA.isOverlapDetectionEnabled() || colB.isOverlapDetectionEnabled()))
-                return false;
-
-            // Prevent static collision
-            if (colA.isStatic() && colB.isStatic())
-                return false;
-
-            // Collidables in excluded collision group do not collide (Collision filtering by group)
-            if ((colA.getCollisionExcludeList().contains(colB.getCollisionGroup())) ||
-                (colB.getCollisionExcludeList().contains(colA.getCollisionGroup())))
-            {
-                return false;
-            }
-
-            // Collidables with different collision id's do not collide (collision filtering by id)
-            if (colA.getCollisionId() != colB.getCollisionId())
-                return false;
-
-            // Satisfies collision requirement
-            return true;
-        }
-    }
-
     Collidable::Collidable(Scene &scene) :
         scene_(&scene),
         sceneDestrucListenerId_(-1),
+        collisionGroupBit_{0},
+        groupRegistry_{nullptr},
         collisionId_{0},
         isStatic_{false},
+        isContinuousColEnabled_{false},
         isOverlapDetEnabled_{true}
     {
+        excludeList_.setOwner(this);
         scene_->addCollidable(this);
 
         // If the scene destructs before the collidable
         sceneDestrucListenerId_ = scene_->onDestruction([this] {
             scene_ = nullptr;
+            setCollisionGroupRegistry(nullptr);
         });
     }
 
+    Collidable::Collidable(const Collidable &other) :
+        scene_{other.scene_},
+        sceneDestrucListenerId_{other.sceneDestrucListenerId_},
+        collisionGroup_{other.collisionGroup_},
+        collisionGroupBit_{other.collisionGroupBit_},
+        groupRegistry_{other.groupRegistry_},
+        collisionId_{other.collisionId_},
+        isStatic_{other.isStatic_},
+        isContinuousColEnabled_{other.isContinuousColEnabled_},
+        isOverlapDetEnabled_{other.isOverlapDetEnabled_},
+        excludeList_{other.excludeList_}
+    {
+        excludeList_.setOwner(this);
+    }
+
     void Collidable::setOverlapDetectionEnable(bool enable) {
-        isOverlapDetEnabled_ = enable;
+        if (isOverlapDetEnabled_ != enable) {
+            isOverlapDetEnabled_ = enable;
+            notifyCollisionFilterChange();
+        }
     }
 
     bool Collidable::isOverlapDetectionEnabled() const {
@@ -82,6 +75,8 @@ namespace mighter2d {
 
     void Collidable::setCollisionGroup(const std::string &colGroup) {
         collisionGroup_ = colGroup;
+        collisionGroupBit_ = groupRegistry_ ? groupRegistry_->getBit(collisionGroup_) : 0;
+        notifyCollisionFilterChange();
     }
 
     const std::string &Collidable::getCollisionGroup() const {
@@ -89,7 +84,10 @@ namespace mighter2d {
     }
 
     void Collidable::setCollisionId(int id) {
-        collisionId_ = id;
+        if (collisionId_ != id) {
+            collisionId_ = id;
+            notifyCollisionFilterChange();
+        }
     }
 
     int Collidable::getCollisionId() const {
@@ -97,13 +95,27 @@ namespace mighter2d {
     }
 
     void Collidable::setStatic(bool isStatic) {
-        isStatic_ = isStatic;
+        if (isStatic_ != isStatic) {
+            isStatic_ = isStatic;
+            notifyCollisionFilterChange();
+        }
     }
 
     bool Collidable::isStatic() const {
         return isStatic_;
     }
 
+    void Collidable::setContinuousCollisionEnable(bool enable) {
+        if (isContinuousColEnabled_ != enable) {
+            isContinuousColEnabled_ = enable;
+            notifyCollisionFilterChange();
+        }
+    }
+
+    bool Collidable::isContinuousCollisionEnabled() const {
+        return isContinuousColEnabled_;
+    }
+
     CollisionExcludeList &Collidable::getCollisionExcludeList() {
         return excludeList_;
     }
@@ -112,55 +124,57 @@ namespace mighter2d {
         return excludeList_;
     }
 
-    void Collidable::handleCollidable(Collidable& other) {
-        if (canCollide(*this, other)) {
-            bool wasColliding = hasCollidable(&other);
-
-            auto bb1 = getBoundingBox();
-            auto bb2 = other.getBoundingBox();
-            bool isColliding = priv::CollisionDetector::isColliding(bb1, bb2);
-            float IoU = 0.0;
-
-            if (isColliding) {
-                IoU = priv::CollisionDetector::getIoU(bb1, bb2);
-            }
-
-            if (wasColliding) {
-                if (isColliding) {
-                    this->onOverlapStay(other, IoU);
-                    other.onOverlapStay(*this, IoU);
-                } else {
-                    this->removeCollidable(&other);
-                    other.removeCollidable(this);
-
-                    // Invoke callbacks
-                    this->onOverlapEnd(other);
-                    other.onOverlapEnd(*this);
-                }
-            } else if (isColliding) {
-                this->addCollidable(&other);
-                other.addCollidable(this);
-
-                //Invoke callbacks
-                this->onOverlapStart(other, IoU);
-                other.onOverlapStart(*this, IoU);
-            }
-        }
+    bool Collidable::canCollideWith(const Collidable &other) const {
+        // Prevent Self collision
+        if (this == &other)
+            return false;
+
+        // Collision disabled
+        if (!(isOverlapDetEnabled_ || other.isOverlapDetEnabled_))
+            return false;
+
+        // Prevent static collision
+        if (isStatic_ && other.isStatic_)
+            return false;
+
+        // Collidables in excluded collision group do not collide (Collision filtering by group)
+        if (isCollisionGroupExcluded(other))
+            return false;
+
+        // Collidables with different collision id's do not collide (collision filtering by id)
+        if (collisionId_ != other.collisionId_)
+            return false;
+
+        // Satisfies collision requirement
+        return true;
+    }
+
+    bool Collidable::isCollisionGroupExcluded(const Collidable &other) const {
+        // The bitmasks can only be used when every group involved is mapped to a bit
+        if (collisionGroupBit_ && other.collisionGroupBit_ && excludeList_.isMaskComplete() && other.excludeList_.isMaskComplete())
+            return (collisionGroupBit_ & other.excludeList_.getMask()) || (other.collisionGroupBit_ & excludeList_.getMask());
+
+        return excludeList_.contains(other.collisionGroup_) || other.excludeList_.contains(collisionGroup_);
     }
 
-    void Collidable::addCollidable(Collidable* collidable) {
-        collidables_.push_back(collidable);
+    void Collidable::setCollisionGroupRegistry(priv::CollisionGroupRegistry *registry) {
+        groupRegistry_ = registry;
+        collisionGroupBit_ = groupRegistry_ ? groupRegistry_->getBit(collisionGroup_) : 0;
+        excludeList_.setGroupRegistry(registry);
     }
 
-    bool Collidable::hasCollidable(Collidable* collidable) {
-        return std::find(collidables_.begin(), collidables_.end(), collidable) != collidables_.end();
+    void Collidable::setScene(Scene &scene) {
+        scene_ = &scene;
     }
 
-    void Collidable::removeCollidable(Collidable* collidable) {
-        auto found = std::find(collidables_.begin(), collidables_.end(), collidable);
+    void Collidable::notifyBoundingBoxChange() {
+        if (scene_)
+            scene_->updateCollidable(this);
+    }
 
-        if (found != collidables_.end())
-            collidables_.erase(found);
+    void Collidable::notifyCollisionFilterChange() {
+        if (scene_)
+            scene_->updateCollidable(this);
     }
 
     Collidable::~Collidable() {
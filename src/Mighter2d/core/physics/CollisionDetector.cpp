@@ -24,6 +24,19 @@
 
 #include "CollisionDetector.h"
 #include <algorithm>
+#include <atomic>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define MIGHTER2D_X86_SIMD
+    #include <immintrin.h>
+
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define MIGHTER2D_TARGET_AVX2
+    #else
+        #define MIGHTER2D_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
 
 namespace mighter2d::priv {
     bool CollisionDetector::isColliding(const mighter2d::BoundingBox &boundingBoxA, const mighter2d::BoundingBox &boundingBoxB) {
@@ -67,4 +80,298 @@ namespace mighter2d::priv {
             return intersection_area / union_area;
         }
     }
+
+    float CollisionDetector::getTimeOfImpact(const BoundingBox &startA, const BoundingBox &endA,
+        const BoundingBox &startB, const BoundingBox &endB)
+    {
+        // Sweep A relative to B, B is considered stationary
+        const Vector2f displacement = (endA.getPosition() - startA.getPosition()) - (endB.getPosition() - startB.getPosition());
+        const float minA[2] = {startA.getPosition().x, startA.getPosition().y};
+        const float maxA[2] = {minA[0] + startA.getSize().x, minA[1] + startA.getSize().y};
+        const float minB[2] = {startB.getPosition().x, startB.getPosition().y};
+        const float maxB[2] = {minB[0] + startB.getSize().x, minB[1] + startB.getSize().y};
+        const float direction[2] = {displacement.x, displacement.y};
+
+        float entryTime = 0.0f, exitTime = 1.0f;
+
+        for (int axis = 0; axis < 2; axis++) {
+            if (direction[axis] == 0.0f) {
+                // No relative motion on this axis, the boxes must already overlap on it
+                if (!(minA[axis] < maxB[axis] && maxA[axis] > minB[axis]))
+                    return -1.0f;
+            } else {
+                float enter = (direction[axis] > 0.0f ? minB[axis] - maxA[axis] : maxB[axis] - minA[axis]) / direction[axis];
+                float exit = (direction[axis] > 0.0f ? maxB[axis] - minA[axis] : minB[axis] - maxA[axis]) / direction[axis];
+
+                entryTime = std::max(entryTime, enter);
+                exitTime = std::min(exitTime, exit);
+            }
+        }
+
+        // Touching edges do not count as an overlap
+        if (entryTime >= exitTime)
+            return -1.0f;
+
+        return entryTime;
+    }
+
+    namespace {
+        using InstructionSet = CollisionDetector::InstructionSet;
+
+        InstructionSet detectInstructionSet() {
+        #if defined(MIGHTER2D_X86_SIMD)
+            #if defined(_MSC_VER) && !defined(__clang__)
+                int info[4];
+                __cpuid(info, 0);
+
+                if (info[0] >= 7) {
+                    __cpuid(info, 1);
+                    bool hasOSXSave = (info[2] & (1 << 27)) != 0;
+                    bool hasAVX = (info[2] & (1 << 28)) != 0;
+
+                    // The OS must save the AVX registers on context switches
+                    if (hasOSXSave && hasAVX && (_xgetbv(0) & 0x6) == 0x6) {
+                        __cpuidex(info, 7, 0);
+
+                        if (info[1] & (1 << 5))
+                            return InstructionSet::AVX2;
+                    }
+                }
+
+                return InstructionSet::SSE2;
+            #else
+                __builtin_cpu_init();
+
+                if (__builtin_cpu_supports("avx2"))
+                    return InstructionSet::AVX2;
+                else if (__builtin_cpu_supports("sse2"))
+                    return InstructionSet::SSE2;
+                else
+                    return InstructionSet::Scalar;
+            #endif
+        #else
+            return InstructionSet::Scalar;
+        #endif
+        }
+
+        std::atomic<InstructionSet>& activeInstructionSet() {
+            static std::atomic<InstructionSet> instructionSet{CollisionDetector::getBestInstructionSet()};
+            return instructionSet;
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Scalar kernels
+        ////////////////////////////////////////////////////////////
+
+        void isCollidingScalar(float left, float top, float right, float bottom, const BoundingBoxBuffer& boxes,
+            std::size_t first, Uint8* results)
+        {
+            const float* lefts = boxes.getLefts();
+            const float* tops = boxes.getTops();
+            const float* rights = boxes.getRights();
+            const float* bottoms = boxes.getBottoms();
+
+            for (std::size_t i = first; i < boxes.getSize(); i++)
+                results[i] = (left < rights[i]) & (right > lefts[i]) & (top < bottoms[i]) & (bottom > tops[i]);
+        }
+
+        void testPairsScalar(const BoundingBoxBuffer& boxes, const Uint32* indicesA, const Uint32* indicesB,
+            std::size_t first, std::size_t count, Uint8* isColliding, float* IoU)
+        {
+            const float* lefts = boxes.getLefts();
+            const float* tops = boxes.getTops();
+            const float* rights = boxes.getRights();
+            const float* bottoms = boxes.getBottoms();
+            const float* areas = boxes.getAreas();
+
+            for (std::size_t i = first; i < count; i++) {
+                Uint32 a = indicesA[i];
+                Uint32 b = indicesB[i];
+
+                isColliding[i] = (lefts[a] < rights[b]) & (rights[a] > lefts[b]) & (tops[a] < bottoms[b]) & (bottoms[a] > tops[b]);
+
+                if (isColliding[i]) {
+                    float intersectionArea = (std::min(rights[a], rights[b]) - std::max(lefts[a], lefts[b]) + 1)
+                        * (std::min(bottoms[a], bottoms[b]) - std::max(tops[a], tops[b]) + 1);
+
+                    IoU[i] = intersectionArea / (areas[a] + areas[b] - intersectionArea);
+                } else
+                    IoU[i] = 0.0f;
+            }
+        }
+
+    #if defined(MIGHTER2D_X86_SIMD)
+        ////////////////////////////////////////////////////////////
+        // SSE2 kernels
+        ////////////////////////////////////////////////////////////
+
+        std::size_t isCollidingSSE2(float left, float top, float right, float bottom, const BoundingBoxBuffer& boxes, Uint8* results) {
+            const __m128 l = _mm_set1_ps(left), t = _mm_set1_ps(top), r = _mm_set1_ps(right), b = _mm_set1_ps(bottom);
+            std::size_t i = 0;
+
+            for (; i + 4 <= boxes.getSize(); i += 4) {
+                __m128 mask = _mm_and_ps(
+                    _mm_and_ps(_mm_cmplt_ps(l, _mm_loadu_ps(boxes.getRights() + i)), _mm_cmpgt_ps(r, _mm_loadu_ps(boxes.getLefts() + i))),
+                    _mm_and_ps(_mm_cmplt_ps(t, _mm_loadu_ps(boxes.getBottoms() + i)), _mm_cmpgt_ps(b, _mm_loadu_ps(boxes.getTops() + i))));
+
+                int bits = _mm_movemask_ps(mask);
+                for (int lane = 0; lane < 4; lane++)
+                    results[i + lane] = static_cast<Uint8>((bits >> lane) & 1);
+            }
+
+            return i;
+        }
+
+        std::size_t testPairsSSE2(const BoundingBoxBuffer& boxes, const Uint32* indicesA, const Uint32* indicesB,
+            std::size_t count, Uint8* isColliding, float* IoU)
+        {
+            auto gather = [](const float* values, const Uint32* indices) {
+                return _mm_setr_ps(values[indices[0]], values[indices[1]], values[indices[2]], values[indices[3]]);
+            };
+
+            const __m128 one = _mm_set1_ps(1.0f);
+            std::size_t i = 0;
+
+            for (; i + 4 <= count; i += 4) {
+                __m128 leftA = gather(boxes.getLefts(), indicesA + i), leftB = gather(boxes.getLefts(), indicesB + i);
+                __m128 topA = gather(boxes.getTops(), indicesA + i), topB = gather(boxes.getTops(), indicesB + i);
+                __m128 rightA = gather(boxes.getRights(), indicesA + i), rightB = gather(boxes.getRights(), indicesB + i);
+                __m128 bottomA = gather(boxes.getBottoms(), indicesA + i), bottomB = gather(boxes.getBottoms(), indicesB + i);
+
+                __m128 mask = _mm_and_ps(_mm_and_ps(_mm_cmplt_ps(leftA, rightB), _mm_cmpgt_ps(rightA, leftB)),
+                                         _mm_and_ps(_mm_cmplt_ps(topA, bottomB), _mm_cmpgt_ps(bottomA, topB)));
+
+                __m128 width = _mm_add_ps(_mm_sub_ps(_mm_min_ps(rightA, rightB), _mm_max_ps(leftA, leftB)), one);
+                __m128 height = _mm_add_ps(_mm_sub_ps(_mm_min_ps(bottomA, bottomB), _mm_max_ps(topA, topB)), one);
+                __m128 intersection = _mm_mul_ps(width, height);
+                __m128 unionArea = _mm_sub_ps(_mm_add_ps(gather(boxes.getAreas(), indicesA + i), gather(boxes.getAreas(), indicesB + i)), intersection);
+
+                _mm_storeu_ps(IoU + i, _mm_and_ps(mask, _mm_div_ps(intersection, unionArea)));
+
+                int bits = _mm_movemask_ps(mask);
+                for (int lane = 0; lane < 4; lane++)
+                    isColliding[i + lane] = static_cast<Uint8>((bits >> lane) & 1);
+            }
+
+            return i;
+        }
+
+        ////////////////////////////////////////////////////////////
+        // AVX2 kernels
+        ////////////////////////////////////////////////////////////
+
+        MIGHTER2D_TARGET_AVX2
+        std::size_t isCollidingAVX2(float left, float top, float right, float bottom, const BoundingBoxBuffer& boxes, Uint8* results) {
+            const __m256 l = _mm256_set1_ps(left), t = _mm256_set1_ps(top), r = _mm256_set1_ps(right), b = _mm256_set1_ps(bottom);
+            std::size_t i = 0;
+
+            for (; i + 8 <= boxes.getSize(); i += 8) {
+                __m256 mask = _mm256_and_ps(
+                    _mm256_and_ps(_mm256_cmp_ps(l, _mm256_loadu_ps(boxes.getRights() + i), _CMP_LT_OQ),
+                                  _mm256_cmp_ps(r, _mm256_loadu_ps(boxes.getLefts() + i), _CMP_GT_OQ)),
+                    _mm256_and_ps(_mm256_cmp_ps(t, _mm256_loadu_ps(boxes.getBottoms() + i), _CMP_LT_OQ),
+                                  _mm256_cmp_ps(b, _mm256_loadu_ps(boxes.getTops() + i), _CMP_GT_OQ)));
+
+                int bits = _mm256_movemask_ps(mask);
+                for (int lane = 0; lane < 8; lane++)
+                    results[i + lane] = static_cast<Uint8>((bits >> lane) & 1);
+            }
+
+            return i;
+        }
+
+        MIGHTER2D_TARGET_AVX2
+        std::size_t testPairsAVX2(const BoundingBoxBuffer& boxes, const Uint32* indicesA, const Uint32* indicesB,
+            std::size_t count, Uint8* isColliding, float* IoU)
+        {
+            const __m256 one = _mm256_set1_ps(1.0f);
+            std::size_t i = 0;
+
+            for (; i + 8 <= count; i += 8) {
+                __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indicesA + i));
+                __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indicesB + i));
+
+                __m256 leftA = _mm256_i32gather_ps(boxes.getLefts(), a, 4), leftB = _mm256_i32gather_ps(boxes.getLefts(), b, 4);
+                __m256 topA = _mm256_i32gather_ps(boxes.getTops(), a, 4), topB = _mm256_i32gather_ps(boxes.getTops(), b, 4);
+                __m256 rightA = _mm256_i32gather_ps(boxes.getRights(), a, 4), rightB = _mm256_i32gather_ps(boxes.getRights(), b, 4);
+                __m256 bottomA = _mm256_i32gather_ps(boxes.getBottoms(), a, 4), bottomB = _mm256_i32gather_ps(boxes.getBottoms(), b, 4);
+
+                __m256 mask = _mm256_and_ps(
+                    _mm256_and_ps(_mm256_cmp_ps(leftA, rightB, _CMP_LT_OQ), _mm256_cmp_ps(rightA, leftB, _CMP_GT_OQ)),
+                    _mm256_and_ps(_mm256_cmp_ps(topA, bottomB, _CMP_LT_OQ), _mm256_cmp_ps(bottomA, topB, _CMP_GT_OQ)));
+
+                __m256 width = _mm256_add_ps(_mm256_sub_ps(_mm256_min_ps(rightA, rightB), _mm256_max_ps(leftA, leftB)), one);
+                __m256 height = _mm256_add_ps(_mm256_sub_ps(_mm256_min_ps(bottomA, bottomB), _mm256_max_ps(topA, topB)), one);
+                __m256 intersection = _mm256_mul_ps(width, height);
+                __m256 unionArea = _mm256_sub_ps(_mm256_add_ps(_mm256_i32gather_ps(boxes.getAreas(), a, 4),
+                    _mm256_i32gather_ps(boxes.getAreas(), b, 4)), intersection);
+
+                _mm256_storeu_ps(IoU + i, _mm256_and_ps(mask, _mm256_div_ps(intersection, unionArea)));
+
+                int bits = _mm256_movemask_ps(mask);
+                for (int lane = 0; lane < 8; lane++)
+                    isColliding[i + lane] = static_cast<Uint8>((bits >> lane) & 1);
+            }
+
+            return i;
+        }
+    #endif
+    }
+
+    void CollisionDetector::isColliding(const BoundingBox &boundingBox, const BoundingBoxBuffer &boundingBoxes, Uint8 *results) {
+        const float left = boundingBox.getPosition().x;
+        const float top = boundingBox.getPosition().y;
+        const float right = left + boundingBox.getSize().x;
+        const float bottom = top + boundingBox.getSize().y;
+        std::size_t processed = 0;
+
+    #if defined(MIGHTER2D_X86_SIMD)
+        switch (getInstructionSet()) {
+            case InstructionSet::AVX2:
+                processed = isCollidingAVX2(left, top, right, bottom, boundingBoxes, results);
+                break;
+            case InstructionSet::SSE2:
+                processed = isCollidingSSE2(left, top, right, bottom, boundingBoxes, results);
+                break;
+            default:
+                break;
+        }
+    #endif
+
+        isCollidingScalar(left, top, right, bottom, boundingBoxes, processed, results);
+    }
+
+    void CollisionDetector::testPairs(const BoundingBoxBuffer &boundingBoxes, const Uint32 *indicesA,
+        const Uint32 *indicesB, std::size_t count, Uint8 *isColliding, float *IoU)
+    {
+        std::size_t processed = 0;
+
+    #if defined(MIGHTER2D_X86_SIMD)
+        switch (getInstructionSet()) {
+            case InstructionSet::AVX2:
+                processed = testPairsAVX2(boundingBoxes, indicesA, indicesB, count, isColliding, IoU);
+                break;
+            case InstructionSet::SSE2:
+                processed = testPairsSSE2(boundingBoxes, indicesA, indicesB, count, isColliding, IoU);
+                break;
+            default:
+                break;
+        }
+    #endif
+
+        testPairsScalar(boundingBoxes, indicesA, indicesB, processed, count, isColliding, IoU);
+    }
+
+    void CollisionDetector::setInstructionSet(InstructionSet instructionSet) {
+        activeInstructionSet() = std::min(instructionSet, getBestInstructionSet());
+    }
+
+    CollisionDetector::InstructionSet CollisionDetector::getInstructionSet() {
+        return activeInstructionSet();
+    }
+
+    CollisionDetector::InstructionSet CollisionDetector::getBestInstructionSet() {
+        static const InstructionSet best = detectInstructionSet();
+        return best;
+    }
 }
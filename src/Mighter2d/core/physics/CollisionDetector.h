@@ -25,7 +25,9 @@
 #ifndef MIGHTER2D_COLLISIONDETECTOR_H
 #define MIGHTER2D_COLLISIONDETECTOR_H
 
+#include "Mighter2d/Config.h"
 #include "Mighter2d/core/physics/BoundingBox.h"
+#include "Mighter2d/core/physics/BoundingBoxBuffer.h"
 
 namespace mighter2d::priv {
     /**
@@ -33,6 +35,15 @@ namespace mighter2d::priv {
      */
     class CollisionDetector {
     public:
+        /**
+         * @brief Instruction sets the batched functions can be executed with
+         */
+        enum class InstructionSet {
+            Scalar, //!< Portable C++, one bounding box at a time
+            SSE2,   //!< Four bounding boxes at a time
+            AVX2    //!< Eight bounding boxes at a time
+        };
+
         /**
          * @brief Check if two bounding boxes are overlapping or not
          * @param boundingBoxA The first bounding box
@@ -51,6 +62,72 @@ namespace mighter2d::priv {
          * and 1 = 100% overlap
          */
         static float getIoU(const BoundingBox& boundingBoxA, const BoundingBox& boundingBoxB);
+
+        /**
+         * @brief Get the time at which two moving bounding boxes start to overlap
+         * @param startA The first bounding box at the start of the motion
+         * @param endA The first bounding box at the end of the motion
+         * @param startB The second bounding box at the start of the motion
+         * @param endB The second bounding box at the end of the motion
+         * @return The time of impact in the range [0, 1] or a negative value
+         *         if the bounding boxes do not overlap during the motion
+         *
+         * The bounding boxes are swept linearly from their start position to
+         * their end position, a time of 0 is the start of the motion and 1 is
+         * the end of the motion. The size of the bounding boxes is assumed to
+         * remain the same during the motion (the start size is used)
+         */
+        static float getTimeOfImpact(const BoundingBox& startA, const BoundingBox& endA,
+            const BoundingBox& startB, const BoundingBox& endB);
+
+        /**
+         * @brief Check if a bounding box overlaps each bounding box in a buffer
+         * @param boundingBox The bounding box to be tested
+         * @param boundingBoxes The bounding boxes to test against
+         * @param results Receives 1 for each overlapping bounding box, otherwise 0 (must
+         *                have room for boundingBoxes.getSize() elements)
+         *
+         * The result for each bounding box is the same as the result of
+         * isColliding(const BoundingBox&, const BoundingBox&)
+         */
+        static void isColliding(const BoundingBox& boundingBox, const BoundingBoxBuffer& boundingBoxes, Uint8* results);
+
+        /**
+         * @brief Test pairs of bounding boxes for an overlap and get their IoU
+         * @param boundingBoxes The bounding boxes referred to by the pairs
+         * @param indicesA The index of the first bounding box of each pair
+         * @param indicesB The index of the second bounding box of each pair
+         * @param count The number of pairs
+         * @param isColliding Receives 1 for each overlapping pair, otherwise 0
+         * @param IoU Receives the IoU of each overlapping pair, 0 for the other pairs
+         *
+         * The results for each pair are the same as the results of
+         * isColliding(const BoundingBox&, const BoundingBox&) and getIoU()
+         */
+        static void testPairs(const BoundingBoxBuffer& boundingBoxes, const Uint32* indicesA,
+            const Uint32* indicesB, std::size_t count, Uint8* isColliding, float* IoU);
+
+        /**
+         * @brief Set the instruction set used by the batched functions
+         * @param instructionSet The instruction set to be used
+         *
+         * If the CPU does not support @a instructionSet, the best instruction
+         * set it supports is used instead. By default, the best instruction
+         * set supported by the CPU is used
+         */
+        static void setInstructionSet(InstructionSet instructionSet);
+
+        /**
+         * @brief Get the instruction set used by the batched functions
+         * @return The instruction set used by the batched functions
+         */
+        static InstructionSet getInstructionSet();
+
+        /**
+         * @brief Get the best instruction set supported by the CPU
+         * @return The best supported instruction set
+         */
+        static InstructionSet getBestInstructionSet();
     };
 }
 
@@ -0,0 +1,48 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/physics/CollisionGroupRegistry.h"
+
+namespace mighter2d::priv {
+    CollisionGroupRegistry::CollisionGroupRegistry() = default;
+
+    std::uint64_t CollisionGroupRegistry::getBit(const std::string &group) {
+        auto found = bits_.find(group);
+
+        if (found != bits_.end())
+            return found->second;
+
+        if (bits_.size() == MAX_GROUPS)
+            return 0;
+
+        std::uint64_t bit = std::uint64_t{1} << bits_.size();
+        bits_.emplace(group, bit);
+
+        return bit;
+    }
+
+    std::size_t CollisionGroupRegistry::getCount() const {
+        return bits_.size();
+    }
+}
@@ -0,0 +1,70 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_COLLISIONGROUPREGISTRY_H
+#define MIGHTER2D_COLLISIONGROUPREGISTRY_H
+
+#include <string>
+#include <unordered_map>
+#include <cstdint>
+
+namespace mighter2d::priv {
+    /**
+     * @brief Maps collision group names to bits
+     *
+     * Each collision group name is assigned a unique bit the first time
+     * it is used. This allows collision filtering by group to be done
+     * with bitwise operations instead of string lookups
+     */
+    class CollisionGroupRegistry {
+    public:
+        static constexpr std::size_t MAX_GROUPS = 64; //!< Maximum number of groups that can be assigned a bit
+
+        /**
+         * @brief Default constructor
+         */
+        CollisionGroupRegistry();
+
+        /**
+         * @brief Get the bit of a collision group
+         * @param group The name of the collision group
+         * @return The bit of the group or 0 if the group does not have
+         *         a bit and all the bits are already taken
+         *
+         * A bit is assigned to the group if it does not have one yet
+         */
+        std::uint64_t getBit(const std::string& group);
+
+        /**
+         * @brief Get the number of groups with a bit
+         * @return The number of registered groups
+         */
+        std::size_t getCount() const;
+
+    private:
+        std::unordered_map<std::string, std::uint64_t> bits_; //!< Group bits
+    };
+}
+
+#endif
@@ -0,0 +1,505 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/physics/CollisionManager.h"
+#include "Mighter2d/core/physics/Collidable.h"
+#include "Mighter2d/core/physics/CollisionDetector.h"
+#include "Mighter2d/utility/WorkerPool.h"
+#include <algorithm>
+
+namespace mighter2d::priv {
+    namespace {
+        std::uint64_t toKey(int proxyIdA, int proxyIdB) {
+            return (static_cast<std::uint64_t>(proxyIdA) << 32) | static_cast<std::uint32_t>(proxyIdB);
+        }
+
+        int getFirstId(std::uint64_t key) {
+            return static_cast<int>(key >> 32);
+        }
+
+        int getSecondId(std::uint64_t key) {
+            return static_cast<int>(key & 0xFFFFFFFFu);
+        }
+
+        // Splitting fewer candidates across threads costs more than it saves
+        constexpr std::size_t MIN_CANDIDATES_PER_THREAD = 512;
+
+        AABB toAABB(const BoundingBox& boundingBox) {
+            const Vector2f& pos = boundingBox.getPosition();
+            const Vector2f& size = boundingBox.getSize();
+
+            return AABB{{std::min(pos.x, pos.x + size.x), std::min(pos.y, pos.y + size.y)},
+                        {std::max(pos.x, pos.x + size.x), std::max(pos.y, pos.y + size.y)}};
+        }
+
+        BoundingBox toBoundingBox(const AABB& box) {
+            return BoundingBox(box.min, box.max - box.min);
+        }
+
+        // Fraction along the segment at which it enters a box, or a negative value if it misses the box
+        float getEntryFraction(const Vector2f& from, const Vector2f& to, const AABB& box) {
+            float tMin = 0.0f, tMax = 1.0f;
+            const float origin[2] = {from.x, from.y};
+            const float direction[2] = {to.x - from.x, to.y - from.y};
+            const float lower[2] = {box.min.x, box.min.y};
+            const float upper[2] = {box.max.x, box.max.y};
+
+            for (int axis = 0; axis < 2; axis++) {
+                if (direction[axis] == 0.0f) {
+                    if (origin[axis] < lower[axis] || origin[axis] > upper[axis])
+                        return -1.0f;
+                } else {
+                    float t1 = (lower[axis] - origin[axis]) / direction[axis];
+                    float t2 = (upper[axis] - origin[axis]) / direction[axis];
+
+                    tMin = std::max(tMin, std::min(t1, t2));
+                    tMax = std::min(tMax, std::max(t1, t2));
+
+                    if (tMin > tMax)
+                        return -1.0f;
+                }
+            }
+
+            return tMin;
+        }
+    }
+
+    CollisionManager::CollisionManager() = default;
+
+    CollisionManager::~CollisionManager() = default;
+
+    void CollisionManager::setThreadCount(unsigned int count) {
+        MIGHTER2D_ASSERT(count > 0, "The collision narrowphase needs at least one thread")
+
+        if (count == getThreadCount())
+            return;
+
+        if (count > 1)
+            workerPool_ = std::make_unique<WorkerPool>(count);
+        else
+            workerPool_.reset();
+    }
+
+    unsigned int CollisionManager::getThreadCount() const {
+        return workerPool_ ? workerPool_->getThreadCount() : 1;
+    }
+
+    void CollisionManager::setCellSize(float size) {
+        broadphase_.setCellSize(size);
+    }
+
+    float CollisionManager::getCellSize() const {
+        return broadphase_.getCellSize();
+    }
+
+    void CollisionManager::addCollidable(Collidable* collidable) {
+        if (proxyIds_.find(collidable) != proxyIds_.end())
+            return;
+
+        int proxyId;
+        if (freeProxyIds_.empty()) {
+            proxyId = static_cast<int>(proxies_.size());
+            proxies_.push_back(Proxy{collidable, -1, true, false, false, false, BoundingBox()});
+        } else {
+            proxyId = freeProxyIds_.back();
+            freeProxyIds_.pop_back();
+            proxies_[proxyId] = Proxy{collidable, -1, true, false, false, false, BoundingBox()};
+        }
+
+        // The bounding box cannot be read yet, the derived class is still being constructed
+        proxyIds_.emplace(collidable, proxyId);
+        collidable->setCollisionGroupRegistry(&groupRegistry_);
+        dirtyProxyIds_.push_back(proxyId);
+    }
+
+    bool CollisionManager::removeCollidable(Collidable* collidable) {
+        auto found = proxyIds_.find(collidable);
+
+        if (found == proxyIds_.end())
+            return false;
+
+        // The id is not reused before the next update, a pair that is yet
+        // to be processed may still refer to it
+        int proxyId = found->second;
+        Proxy& proxy = proxies_[proxyId];
+
+        if (proxy.treeProxyId != -1)
+            tree_.destroyProxy(proxy.treeProxyId);
+
+        proxy = Proxy{nullptr, -1, false, false, false, false, BoundingBox()};
+        broadphase_.remove(proxyId);
+        releasedProxyIds_.push_back(proxyId);
+        proxyIds_.erase(found);
+
+        return true;
+    }
+
+    void CollisionManager::updateCollidable(Collidable* collidable) {
+        auto found = proxyIds_.find(collidable);
+
+        if (found != proxyIds_.end() && !proxies_[found->second].isDirty) {
+            proxies_[found->second].isDirty = true;
+            dirtyProxyIds_.push_back(found->second);
+        }
+    }
+
+    std::size_t CollisionManager::getCollidableCount() const {
+        return proxyIds_.size();
+    }
+
+    void CollisionManager::forEachCollidable(const Callback<Collidable&>& callback) const {
+        for (const auto& proxyId : proxyIds_)
+            callback(*proxyId.first);
+    }
+
+    void CollisionManager::queryAABB(const FloatRect& rect, const Callback<Collidable&>& callback) {
+        syncDirtyProxies();
+
+        BoundingBox queryBox({rect.left, rect.top}, {rect.width, rect.height});
+        std::vector<int> hits;
+
+        tree_.query(toAABB(queryBox), [&](int proxyId) {
+            if (CollisionDetector::isColliding(proxies_[proxyId].collidable->getBoundingBox(), queryBox))
+                hits.push_back(proxyId);
+        });
+
+        dispatchHits(hits, callback);
+    }
+
+    void CollisionManager::queryPoint(const Vector2f& point, const Callback<Collidable&>& callback) {
+        syncDirtyProxies();
+
+        std::vector<int> hits;
+
+        tree_.query(AABB{point, point}, [&](int proxyId) {
+            AABB box = toAABB(proxies_[proxyId].collidable->getBoundingBox());
+
+            if (point.x >= box.min.x && point.x < box.max.x && point.y >= box.min.y && point.y < box.max.y)
+                hits.push_back(proxyId);
+        });
+
+        dispatchHits(hits, callback);
+    }
+
+    void CollisionManager::raycast(const Vector2f& from, const Vector2f& to, const Callback<Collidable&, float>& callback) {
+        syncDirtyProxies();
+
+        std::vector<std::pair<float, int>> hits;
+
+        tree_.rayCast(from, to, [&](int proxyId) {
+            float fraction = getEntryFraction(from, to, toAABB(proxies_[proxyId].collidable->getBoundingBox()));
+
+            if (fraction >= 0.0f)
+                hits.emplace_back(fraction, proxyId);
+        });
+
+        // Closest hit first
+        std::sort(hits.begin(), hits.end());
+
+        for (const auto& [fraction, proxyId] : hits) {
+            if (proxies_[proxyId].collidable)
+                callback(*proxies_[proxyId].collidable, fraction);
+        }
+    }
+
+    void CollisionManager::update() {
+        if (!releasedProxyIds_.empty()) {
+            contacts_.erase(std::remove_if(contacts_.begin(), contacts_.end(), [this](const Contact& contact) {
+                return !proxies_[getFirstId(contact.key)].collidable || !proxies_[getSecondId(contact.key)].collidable;
+            }), contacts_.end());
+
+            freeProxyIds_.insert(freeProxyIds_.end(), releasedProxyIds_.begin(), releasedProxyIds_.end());
+            releasedProxyIds_.clear();
+        }
+
+        // Stationary collidables are not synced, their bounding box is still up to date
+        syncDirtyProxies();
+
+        pairs_.clear();
+        broadphase_.findPairs(changedProxyIds_, pairs_);
+
+        findContacts();
+
+        // Collidables changed by the callbacks are tested at the next update
+        clearChangedProxies();
+        dispatchContacts();
+
+        contacts_.swap(newContacts_);
+    }
+
+    void CollisionManager::findContacts() {
+        newContacts_.clear();
+        candidates_.clear();
+        candidateIdsA_.clear();
+        candidateIdsB_.clear();
+
+        auto pair = pairs_.begin();
+        auto prevContact = contacts_.begin();
+
+        // A pair that was overlapping in the previous update is tested again even if
+        // its collidables no longer share a cell, otherwise the overlap never ends
+        while (pair != pairs_.end() || prevContact != contacts_.end()) {
+            Candidate candidate{0, nullptr, 0, true};
+
+            if (prevContact == contacts_.end() || (pair != pairs_.end() && toKey(pair->first, pair->second) < prevContact->key)) {
+                candidate.key = toKey(pair->first, pair->second);
+                ++pair;
+            } else {
+                candidate.key = prevContact->key;
+                candidate.prev = &*prevContact++;
+
+                if (pair != pairs_.end() && toKey(pair->first, pair->second) == candidate.key)
+                    ++pair;
+            }
+
+            const Proxy& proxyA = proxies_[getFirstId(candidate.key)];
+            const Proxy& proxyB = proxies_[getSecondId(candidate.key)];
+
+            if (!proxyA.collidable || !proxyB.collidable)
+                continue;
+
+            // Static collidables never collide with each other, there is no need to look further
+            if (!candidate.prev && proxyA.isStatic && proxyB.isStatic)
+                continue;
+
+            // An overlap that only happened during the motion of the previous frame must end
+            candidate.isTested = proxyA.hasChanged || proxyB.hasChanged || (candidate.prev && candidate.prev->isSwept);
+            candidate.testIndex = candidateIdsA_.size();
+            candidates_.push_back(candidate);
+
+            if (candidate.isTested) {
+                candidateIdsA_.push_back(static_cast<Uint32>(getFirstId(candidate.key)));
+                candidateIdsB_.push_back(static_cast<Uint32>(getSecondId(candidate.key)));
+            }
+        }
+
+        isColliding_.resize(candidateIdsA_.size());
+        IoUs_.resize(candidateIdsA_.size());
+
+        const std::size_t chunkCount = workerPool_ ? std::min<std::size_t>(workerPool_->getThreadCount(),
+            candidates_.size() / MIN_CANDIDATES_PER_THREAD) : 1;
+
+        if (chunkCount <= 1) {
+            testCandidates(0, candidates_.size(), newContacts_);
+            return;
+        }
+
+        // Each thread processes a contiguous range of the candidates, the ranges are
+        // sorted by key, so merging the thread buffers in order keeps the contacts sorted
+        workerContacts_.resize(workerPool_->getThreadCount());
+        workerPool_->run([this, chunkCount](std::size_t thread) {
+            workerContacts_[thread].clear();
+
+            if (thread < chunkCount) {
+                testCandidates(candidates_.size() * thread / chunkCount,
+                    candidates_.size() * (thread + 1) / chunkCount, workerContacts_[thread]);
+            }
+        });
+
+        for (std::size_t i = 0; i < chunkCount; i++)
+            newContacts_.insert(newContacts_.end(), workerContacts_[i].begin(), workerContacts_[i].end());
+    }
+
+    void CollisionManager::testCandidates(std::size_t begin, std::size_t end, std::vector<Contact>& contacts) {
+        if (begin == end)
+            return;
+
+        const std::size_t firstTest = candidates_[begin].testIndex;
+        const std::size_t lastTest = end < candidates_.size() ? candidates_[end].testIndex : candidateIdsA_.size();
+
+        CollisionDetector::testPairs(boundingBoxes_, candidateIdsA_.data() + firstTest, candidateIdsB_.data() + firstTest,
+            lastTest - firstTest, isColliding_.data() + firstTest, IoUs_.data() + firstTest);
+
+        for (std::size_t c = begin; c < end; c++) {
+            const Candidate& candidate = candidates_[c];
+
+            // Neither collidable changed, neither did the overlap
+            if (!candidate.isTested) {
+                contacts.push_back(*candidate.prev);
+                continue;
+            }
+
+            const std::size_t i = candidate.testIndex;
+
+            const Proxy& proxyA = proxies_[candidateIdsA_[i]];
+            const Proxy& proxyB = proxies_[candidateIdsB_[i]];
+
+            if (!candidate.prev && !isColliding_[i] && !proxyA.isContinuous && !proxyB.isContinuous)
+                continue;
+
+            const Collidable* collidableA = proxyA.collidable;
+            const Collidable* collidableB = proxyB.collidable;
+
+            // A filtered pair keeps its overlap state until it is allowed to collide again
+            if (!collidableA->canCollideWith(*collidableB)) {
+                if (candidate.prev)
+                    contacts.push_back(Contact{candidate.key, candidate.prev->IoU, candidate.prev->timeOfImpact, true, false});
+
+                continue;
+            }
+
+            if (isColliding_[i]) {
+                // The time of impact of an overlap that already existed is irrelevant
+                float timeOfImpact = 1.0f;
+                if (!candidate.prev && (proxyA.isContinuous || proxyB.isContinuous))
+                    timeOfImpact = std::max(0.0f, getTimeOfImpact(candidateIdsA_[i], candidateIdsB_[i]));
+
+                contacts.push_back(Contact{candidate.key, IoUs_[i], timeOfImpact, false, false});
+            } else if (!candidate.prev) {
+                // The collidables passed through each other during the frame
+                float timeOfImpact = getTimeOfImpact(candidateIdsA_[i], candidateIdsB_[i]);
+
+                if (timeOfImpact >= 0.0f)
+                    contacts.push_back(Contact{candidate.key, 0.0f, timeOfImpact, false, true});
+            }
+        }
+    }
+
+    void CollisionManager::dispatchContacts() {
+        auto prevContact = contacts_.begin();
+        auto contact = newContacts_.begin();
+
+        while (prevContact != contacts_.end() || contact != newContacts_.end()) {
+            enum class State {Start, Stay, End} state;
+            const Contact* current;
+
+            if (prevContact == contacts_.end() || (contact != newContacts_.end() && contact->key < prevContact->key)) {
+                state = State::Start;
+                current = &*contact++;
+            } else if (contact == newContacts_.end() || prevContact->key < contact->key) {
+                state = State::End;
+                current = &*prevContact++;
+            } else {
+                state = State::Stay;
+                current = &*contact++;
+                ++prevContact;
+            }
+
+            // An overlap that is still filtered does not invoke callbacks
+            if (state == State::Stay && current->isFiltered)
+                continue;
+
+            // The collidables are looked up before each callback, a callback may remove them
+            const int idA = getFirstId(current->key);
+            const int idB = getSecondId(current->key);
+            auto isAlive = [this, idA, idB] {
+                return proxies_[idA].collidable && proxies_[idB].collidable;
+            };
+
+            if (!isAlive())
+                continue;
+
+            if (state == State::Start) {
+                proxies_[idA].collidable->onSweptOverlapStart(*proxies_[idB].collidable, current->IoU, current->timeOfImpact);
+
+                if (isAlive())
+                    proxies_[idB].collidable->onSweptOverlapStart(*proxies_[idA].collidable, current->IoU, current->timeOfImpact);
+            } else if (state == State::Stay) {
+                proxies_[idA].collidable->onOverlapStay(*proxies_[idB].collidable, current->IoU);
+
+                if (isAlive())
+                    proxies_[idB].collidable->onOverlapStay(*proxies_[idA].collidable, current->IoU);
+            } else {
+                proxies_[idA].collidable->onOverlapEnd(*proxies_[idB].collidable);
+
+                if (isAlive())
+                    proxies_[idB].collidable->onOverlapEnd(*proxies_[idA].collidable);
+            }
+        }
+    }
+
+    void CollisionManager::syncProxy(int proxyId) {
+        Proxy& proxy = proxies_[proxyId];
+        const BoundingBox& boundingBox = proxy.collidable->getBoundingBox();
+        AABB box = toAABB(boundingBox);
+
+        if (proxy.treeProxyId == -1)
+            proxy.sweepStart = boundingBox;
+
+        proxy.isContinuous = proxy.collidable->isContinuousCollisionEnabled();
+
+        // The broadphase must report the collidables passed through during the motion
+        if (proxy.isContinuous)
+            broadphase_.update(proxyId, toBoundingBox(AABB::merge(toAABB(proxy.sweepStart), box)));
+        else
+            broadphase_.update(proxyId, boundingBox);
+
+        if (boundingBoxes_.getSize() <= static_cast<std::size_t>(proxyId))
+            boundingBoxes_.resize(proxies_.size());
+
+        boundingBoxes_.set(proxyId, boundingBox);
+        proxy.isStatic = proxy.collidable->isStatic();
+
+        if (!proxy.hasChanged) {
+            proxy.hasChanged = true;
+            changedProxyIds_.push_back(proxyId);
+        }
+
+        if (proxy.treeProxyId == -1)
+            proxy.treeProxyId = tree_.createProxy(box, proxyId);
+        else
+            tree_.moveProxy(proxy.treeProxyId, box);
+
+        proxy.isDirty = false;
+    }
+
+    void CollisionManager::syncDirtyProxies() {
+        for (int proxyId : dirtyProxyIds_) {
+            if (proxies_[proxyId].collidable && proxies_[proxyId].isDirty)
+                syncProxy(proxyId);
+        }
+
+        dirtyProxyIds_.clear();
+    }
+
+    float CollisionManager::getTimeOfImpact(Uint32 proxyIdA, Uint32 proxyIdB) const {
+        return CollisionDetector::getTimeOfImpact(proxies_[proxyIdA].sweepStart, boundingBoxes_.get(proxyIdA),
+            proxies_[proxyIdB].sweepStart, boundingBoxes_.get(proxyIdB));
+    }
+
+    void CollisionManager::clearChangedProxies() {
+        for (int proxyId : changedProxyIds_) {
+            Proxy& proxy = proxies_[proxyId];
+
+            if (!proxy.collidable)
+                continue;
+
+            // The next motion starts where this one ended
+            proxy.hasChanged = false;
+            proxy.sweepStart = boundingBoxes_.get(proxyId);
+
+            if (proxy.isContinuous)
+                broadphase_.update(proxyId, proxy.sweepStart);
+        }
+
+        changedProxyIds_.clear();
+    }
+
+    void CollisionManager::dispatchHits(const std::vector<int>& hits, const Callback<Collidable&>& callback) {
+        for (int proxyId : hits) {
+            if (proxies_[proxyId].collidable)
+                callback(*proxies_[proxyId].collidable);
+        }
+    }
+}
@@ -0,0 +1,305 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_COLLISIONMANAGER_H
+#define MIGHTER2D_COLLISIONMANAGER_H
+
+#include "Mighter2d/core/physics/SpatialHash.h"
+#include "Mighter2d/core/physics/AABBTree.h"
+#include "Mighter2d/core/physics/CollisionGroupRegistry.h"
+#include "Mighter2d/core/physics/BoundingBoxBuffer.h"
+#include "Mighter2d/core/event/EventEmitter.h"
+#include "Mighter2d/common/Rect.h"
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace mighter2d {
+    class Collidable;
+
+    /// @internal
+    namespace priv {
+        class WorkerPool;
+
+        /**
+         * @brief Detects and dispatches overlaps between the collidables of a scene
+         *
+         * Instead of testing every collidable against every other collidable,
+         * the collidables are first registered in a uniform grid (broadphase)
+         * and only the collidables that share a grid cell are tested for an
+         * actual overlap (narrowphase). The narrowphase tests the candidate
+         * pairs in batches using the SIMD kernels of the collision detector.
+         *
+         * Only the pairs involving a collidable that changed (moved, resized
+         * or had its collision filter modified) since the last update are
+         * tested, the other pairs keep their overlap state from the previous
+         * update. In steady state, the cost of an update is therefore
+         * proportional to the number of moving collidables.
+         *
+         * The collidables are also kept in a bounding volume hierarchy which
+         * answers spatial queries.
+         *
+         * The narrowphase can optionally be split across worker threads. The
+         * collision callbacks are always invoked on the thread that calls
+         * update() and in the same order regardless of the number of threads
+         */
+        class CollisionManager final {
+        public:
+            /**
+             * @brief Default constructor
+             */
+            CollisionManager();
+
+            /**
+             * @brief Copy constructor
+             */
+            CollisionManager(const CollisionManager&) = delete;
+
+            /**
+             * @brief Copy assignment operator
+             */
+            CollisionManager& operator=(const CollisionManager&) = delete;
+
+            /**
+             * @brief Set the number of threads the narrowphase is split across
+             * @param count The number of threads, including the thread calling update()
+             *
+             * @see mighter2d::Scene::setCollisionThreadCount
+             */
+            void setThreadCount(unsigned int count);
+
+            /**
+             * @brief Get the number of threads the narrowphase is split across
+             * @return The number of threads, including the thread calling update()
+             */
+            unsigned int getThreadCount() const;
+
+            /**
+             * @brief Set the size of a broadphase cell
+             * @param size The width and height of a cell in pixels
+             *
+             * @see mighter2d::Scene::setCollisionCellSize
+             */
+            void setCellSize(float size);
+
+            /**
+             * @brief Get the size of a broadphase cell
+             * @return The width and height of a cell in pixels
+             */
+            float getCellSize() const;
+
+            /**
+             * @brief Add a collidable
+             * @param collidable The collidable to be added
+             */
+            void addCollidable(Collidable* collidable);
+
+            /**
+             * @brief Remove a collidable
+             * @param collidable The collidable to be removed
+             * @return True if the collidable was removed or false if it does not exist
+             */
+            bool removeCollidable(Collidable* collidable);
+
+            /**
+             * @brief Flag a collidable as changed
+             * @param collidable The collidable whose bounding box or collision filter changed
+             *
+             * The collidable is refitted in the bounding volume hierarchy the
+             * next time a spatial query is made or at the next update. Its
+             * pairs are tested by the narrowphase at the next update
+             */
+            void updateCollidable(Collidable* collidable);
+
+            /**
+             * @brief Get the number of collidables
+             * @return The number of collidables
+             */
+            std::size_t getCollidableCount() const;
+
+            /**
+             * @brief Execute a function for each collidable
+             * @param callback The function to be executed
+             */
+            void forEachCollidable(const Callback<Collidable&>& callback) const;
+
+            /**
+             * @brief Find all the collidables that overlap a rectangle
+             * @param rect The rectangle to be tested
+             * @param callback Function called for every overlapping collidable
+             *
+             * @see mighter2d::Scene::queryAABB
+             */
+            void queryAABB(const FloatRect& rect, const Callback<Collidable&>& callback);
+
+            /**
+             * @brief Find all the collidables that contain a point
+             * @param point The point to be tested
+             * @param callback Function called for every collidable containing the point
+             *
+             * @see mighter2d::Scene::queryPoint
+             */
+            void queryPoint(const Vector2f& point, const Callback<Collidable&>& callback);
+
+            /**
+             * @brief Find all the collidables crossed by a line segment
+             * @param from The start point of the segment
+             * @param to The end point of the segment
+             * @param callback Function called for every crossed collidable
+             *
+             * @see mighter2d::Scene::raycast
+             */
+            void raycast(const Vector2f& from, const Vector2f& to, const Callback<Collidable&, float>& callback);
+
+            /**
+             * @brief Detect overlaps and invoke the collision callbacks
+             *
+             * The overlaps of the collidables that did not change since the
+             * last update are not tested again.
+             *
+             * The overlaps of the current update are diffed against the
+             * overlaps of the previous update: new overlaps start, common
+             * overlaps stay and missing overlaps end. Both lists are sorted
+             * by pair key, so the callbacks are invoked in a deterministic
+             * order
+             */
+            void update();
+
+            /**
+             * @brief Destructor
+             */
+            ~CollisionManager();
+
+        private:
+            /**
+             * @brief Broadphase proxy of a collidable
+             */
+            struct Proxy {
+                Collidable* collidable; //!< The collidable, nullptr if the proxy is not in use
+                int treeProxyId;        //!< The id of the collidable in the bounding volume hierarchy
+                bool isDirty;           //!< True if the bounding box changed since it was last synced
+                bool hasChanged;        //!< True if the proxy was synced since the last update
+                bool isStatic;          //!< True if the collidable was static when the proxy was last synced
+                bool isContinuous;      //!< True if the collidable had continuous collision detection enabled when the proxy was last synced
+                BoundingBox sweepStart; //!< The bounding box at the last update, start of the swept motion
+            };
+
+            /**
+             * @brief Overlapping pair
+             */
+            struct Contact {
+                std::uint64_t key;      //!< Proxy ids of the pair packed as (lower id << 32 | higher id)
+                float IoU;              //!< Intersection over union of the bounding boxes
+                float timeOfImpact;     //!< The time within the update at which the overlap started
+                bool isFiltered;        //!< True if the pair is no longer allowed to collide (no callbacks are invoked)
+                bool isSwept;           //!< True if the pair only overlapped during the motion, it must be tested at the next update
+            };
+
+            /**
+             * @brief Pair to be tested by the narrowphase
+             */
+            struct Candidate {
+                std::uint64_t key;      //!< Proxy ids of the pair packed as (lower id << 32 | higher id)
+                const Contact* prev;    //!< The contact of the pair in the previous update, nullptr if there is none
+                std::size_t testIndex;  //!< The number of tested candidates that precede this candidate
+                bool isTested;          //!< False if neither proxy changed, the previous contact is kept as is
+            };
+
+            /**
+             * @brief Helper function for finding the overlapping pairs among the candidate pairs
+             */
+            void findContacts();
+
+            /**
+             * @brief Helper function for testing a range of candidates
+             * @param begin The index of the first candidate to be tested
+             * @param end One past the index of the last candidate to be tested
+             * @param contacts The vector to append the overlapping pairs to
+             *
+             * Ranges that do not overlap can be tested concurrently
+             */
+            void testCandidates(std::size_t begin, std::size_t end, std::vector<Contact>& contacts);
+
+            /**
+             * @brief Helper function for invoking the collision callbacks of the contacts that changed
+             */
+            void dispatchContacts();
+
+            /**
+             * @brief Helper function for syncing a proxy with the bounding box of its collidable
+             */
+            void syncProxy(int proxyId);
+
+            /**
+             * @brief Helper function for syncing all the proxies flagged as dirty
+             */
+            void syncDirtyProxies();
+
+            /**
+             * @brief Helper function for computing the time of impact of two proxies
+             * @return The time of impact or a negative value if the proxies did not overlap during their motion
+             */
+            float getTimeOfImpact(Uint32 proxyIdA, Uint32 proxyIdB) const;
+
+            /**
+             * @brief Helper function for clearing the changed flag of the proxies synced since the last update
+             *
+             * The current bounding boxes of the proxies become the start of their next swept motion
+             */
+            void clearChangedProxies();
+
+            /**
+             * @brief Helper function for invoking a query callback on query hits
+             *
+             * The callback is not invoked for collidables removed by a previous
+             * invocation of the callback
+             */
+            void dispatchHits(const std::vector<int>& hits, const Callback<Collidable&>& callback);
+
+        private:
+            std::vector<Proxy> proxies_;                           //!< Proxies indexed by their id
+            std::unordered_map<Collidable*, int> proxyIds_;        //!< Proxy ids of the collidables
+            std::vector<int> freeProxyIds_;                        //!< Proxy ids available for reuse
+            std::vector<int> releasedProxyIds_;                    //!< Proxy ids released since the last update
+            std::vector<int> dirtyProxyIds_;                       //!< Proxies whose bounding box changed since they were last synced
+            std::vector<int> changedProxyIds_;                     //!< Proxies synced since the last update
+            SpatialHash broadphase_;                               //!< Generates the candidate pairs
+            AABBTree tree_;                                        //!< Answers spatial queries
+            CollisionGroupRegistry groupRegistry_;                 //!< Maps the collision groups of the collidables to bits
+            BoundingBoxBuffer boundingBoxes_;                      //!< Bounding boxes of the proxies as of the last sync, indexed by proxy id
+            std::vector<SpatialHash::Pair> pairs_;                 //!< Candidate pairs of the current update
+            std::vector<Candidate> candidates_;                    //!< Pairs tested by the narrowphase of the current update
+            std::vector<Uint32> candidateIdsA_;                    //!< First proxy id of each tested candidate
+            std::vector<Uint32> candidateIdsB_;                    //!< Second proxy id of each tested candidate
+            std::vector<Uint8> isColliding_;                       //!< Narrowphase overlap result of each tested candidate
+            std::vector<float> IoUs_;                              //!< Narrowphase IoU result of each tested candidate
+            std::unique_ptr<WorkerPool> workerPool_;               //!< Threads the narrowphase is split across, nullptr if single threaded
+            std::vector<std::vector<Contact>> workerContacts_;     //!< Overlapping pairs found by each thread
+            std::vector<Contact> contacts_;                        //!< Overlapping pairs of the previous update, sorted by key
+            std::vector<Contact> newContacts_;                     //!< Overlapping pairs of the current update, sorted by key
+        };
+    }
+}
+
+#endif
@@ -384,11 +384,8 @@ namespace mighter2d {
             return false;
 
         // Objects in excluded collision group do not collide (Collision filtering by group)
-        if ((target_->getCollisionExcludeList().contains(other->getCollisionGroup())) ||
-            (other->getCollisionExcludeList().contains(target_->getCollisionGroup())))
-        {
+        if (target_->isCollisionGroupExcluded(*other))
             return false;
-        }
 
         // Objects with different collision id's do not collide (collision filtering by id)
         if (target_->getCollisionId() != other->getCollisionId())
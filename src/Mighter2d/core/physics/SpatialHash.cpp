@@ -0,0 +1,206 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/physics/SpatialHash.h"
+#include "Mighter2d/Config.h"
+#include <algorithm>
+#include <cmath>
+
+namespace mighter2d::priv {
+    namespace {
+        // Proxies spanning more cells than this are not hashed, they are
+        // tested against every other proxy instead
+        constexpr float MAX_CELLS_PER_PROXY = 64.0f;
+
+        std::uint64_t toKey(int x, int y) {
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32)
+                | static_cast<std::uint32_t>(y);
+        }
+    }
+
+    SpatialHash::SpatialHash(float cellSize) :
+        cellSize_{cellSize}
+    {
+        MIGHTER2D_ASSERT(cellSize > 0.0f, "The cell size of a spatial hash must be greater than zero")
+    }
+
+    void SpatialHash::setCellSize(float cellSize) {
+        MIGHTER2D_ASSERT(cellSize > 0.0f, "The cell size of a spatial hash must be greater than zero")
+
+        if (cellSize_ == cellSize || cellSize <= 0.0f)
+            return;
+
+        cellSize_ = cellSize;
+        cells_.clear();
+        oversized_.clear();
+
+        for (int i = 0; i < static_cast<int>(proxies_.size()); i++) {
+            if (proxies_[i].isInUse)
+                addProxy(i, proxies_[i]);
+        }
+    }
+
+    float SpatialHash::getCellSize() const {
+        return cellSize_;
+    }
+
+    void SpatialHash::update(int proxyId, const BoundingBox& boundingBox) {
+        MIGHTER2D_ASSERT(proxyId >= 0, "Invalid spatial hash proxy id")
+
+        if (proxyId >= static_cast<int>(proxies_.size()))
+            proxies_.resize(proxyId + 1, Proxy{BoundingBox(), CellRange{}, false, false});
+
+        Proxy& proxy = proxies_[proxyId];
+
+        if (proxy.isInUse) {
+            CellRange range = computeRange(boundingBox);
+            const CellRange& old = proxy.range;
+            proxy.boundingBox = boundingBox;
+
+            // Most updates do not move the proxy to a different cell
+            if (range.left == old.left && range.top == old.top &&
+                range.right == old.right && range.bottom == old.bottom)
+            {
+                return;
+            }
+
+            removeProxy(proxyId, proxy);
+        }
+
+        proxy.boundingBox = boundingBox;
+        proxy.isInUse = true;
+        addProxy(proxyId, proxy);
+    }
+
+    void SpatialHash::remove(int proxyId) {
+        if (proxyId >= 0 && proxyId < static_cast<int>(proxies_.size()) && proxies_[proxyId].isInUse) {
+            removeProxy(proxyId, proxies_[proxyId]);
+            proxies_[proxyId].isInUse = false;
+        }
+    }
+
+    void SpatialHash::clear() {
+        cells_.clear();
+        proxies_.clear();
+        oversized_.clear();
+    }
+
+    void SpatialHash::findPairs(const std::vector<int>& proxyIds, std::vector<Pair>& pairs) const {
+        std::size_t first = pairs.size();
+
+        for (int proxyId : proxyIds) {
+            if (proxyId < 0 || proxyId >= static_cast<int>(proxies_.size()) || !proxies_[proxyId].isInUse)
+                continue;
+
+            const Proxy& proxy = proxies_[proxyId];
+
+            if (proxy.isOversized) {
+                for (int i = 0; i < static_cast<int>(proxies_.size()); i++) {
+                    if (i != proxyId && proxies_[i].isInUse)
+                        pairs.emplace_back(std::minmax(proxyId, i));
+                }
+
+                continue;
+            }
+
+            for (int x = proxy.range.left; x <= proxy.range.right; x++) {
+                for (int y = proxy.range.top; y <= proxy.range.bottom; y++) {
+                    auto cell = cells_.find(toKey(x, y));
+
+                    if (cell == cells_.end())
+                        continue;
+
+                    for (int otherId : cell->second) {
+                        if (otherId != proxyId)
+                            pairs.emplace_back(std::minmax(proxyId, otherId));
+                    }
+                }
+            }
+
+            for (int oversizedId : oversized_)
+                pairs.emplace_back(std::minmax(proxyId, oversizedId));
+        }
+
+        // Proxies sharing multiple cells and pairs of two given proxies are found more than once
+        std::sort(pairs.begin() + static_cast<std::ptrdiff_t>(first), pairs.end());
+        pairs.erase(std::unique(pairs.begin() + static_cast<std::ptrdiff_t>(first), pairs.end()), pairs.end());
+    }
+
+    SpatialHash::CellRange SpatialHash::computeRange(const BoundingBox& boundingBox) const {
+        const Vector2f& pos = boundingBox.getPosition();
+        const Vector2f& size = boundingBox.getSize();
+
+        float left = std::floor(std::min(pos.x, pos.x + size.x) / cellSize_);
+        float top = std::floor(std::min(pos.y, pos.y + size.y) / cellSize_);
+        float right = std::floor(std::max(pos.x, pos.x + size.x) / cellSize_);
+        float bottom = std::floor(std::max(pos.y, pos.y + size.y) / cellSize_);
+
+        // Invalid range, marks the proxy as oversized
+        if (!((right - left + 1.0f) * (bottom - top + 1.0f) <= MAX_CELLS_PER_PROXY))
+            return CellRange{};
+
+        return CellRange{static_cast<int>(left), static_cast<int>(top), static_cast<int>(right), static_cast<int>(bottom)};
+    }
+
+    void SpatialHash::addProxy(int proxyId, Proxy& proxy) {
+        proxy.range = computeRange(proxy.boundingBox);
+        proxy.isOversized = proxy.range.right < proxy.range.left;
+
+        if (proxy.isOversized) {
+            oversized_.push_back(proxyId);
+            return;
+        }
+
+        for (int x = proxy.range.left; x <= proxy.range.right; x++) {
+            for (int y = proxy.range.top; y <= proxy.range.bottom; y++)
+                cells_[toKey(x, y)].push_back(proxyId);
+        }
+    }
+
+    void SpatialHash::removeProxy(int proxyId, Proxy& proxy) {
+        if (proxy.isOversized) {
+            oversized_.erase(std::remove(oversized_.begin(), oversized_.end(), proxyId), oversized_.end());
+            return;
+        }
+
+        for (int x = proxy.range.left; x <= proxy.range.right; x++) {
+            for (int y = proxy.range.top; y <= proxy.range.bottom; y++) {
+                auto cell = cells_.find(toKey(x, y));
+
+                if (cell != cells_.end()) {
+                    std::vector<int>& bucket = cell->second;
+                    auto found = std::find(bucket.begin(), bucket.end(), proxyId);
+
+                    if (found != bucket.end()) {
+                        *found = bucket.back();
+                        bucket.pop_back();
+                    }
+
+                    if (bucket.empty())
+                        cells_.erase(cell);
+                }
+            }
+        }
+    }
+}
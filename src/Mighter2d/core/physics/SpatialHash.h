@@ -0,0 +1,147 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_SPATIALHASH_H
+#define MIGHTER2D_SPATIALHASH_H
+
+#include "Mighter2d/core/physics/BoundingBox.h"
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <cstdint>
+
+namespace mighter2d::priv {
+    /**
+     * @brief Uniform grid spatial hash used as a collision broadphase
+     *
+     * Each proxy (identified by a non-negative integer id) is registered in
+     * every cell its bounding box touches. Only proxies that share a cell
+     * can overlap, therefore the pairs reported by the hash are the only
+     * pairs that need to be tested by the narrowphase.
+     *
+     * The hash is persistent: updating a proxy whose bounding box still
+     * touches the same cells does not touch the cell buckets at all
+     */
+    class SpatialHash {
+    public:
+        using Pair = std::pair<int, int>; //!< Candidate pair (first < second)
+
+        /**
+         * @brief Constructor
+         * @param cellSize The width and height of a cell in pixels
+         */
+        explicit SpatialHash(float cellSize = 64.0f);
+
+        /**
+         * @brief Set the size of a cell
+         * @param cellSize The new width and height of a cell in pixels
+         *
+         * All registered proxies are rehashed when the cell size changes.
+         * Ideally the cell size should be slightly larger than the size of
+         * a typical collidable
+         */
+        void setCellSize(float cellSize);
+
+        /**
+         * @brief Get the size of a cell
+         * @return The width and height of a cell in pixels
+         */
+        float getCellSize() const;
+
+        /**
+         * @brief Add a proxy or update the bounding box of an existing proxy
+         * @param proxyId The id of the proxy
+         * @param boundingBox The bounding box of the proxy
+         */
+        void update(int proxyId, const BoundingBox& boundingBox);
+
+        /**
+         * @brief Remove a proxy
+         * @param proxyId The id of the proxy to be removed
+         */
+        void remove(int proxyId);
+
+        /**
+         * @brief Remove all proxies
+         */
+        void clear();
+
+        /**
+         * @brief Get the proxy pairs that share at least one cell and involve given proxies
+         * @param proxyIds The proxies whose pairs are to be found
+         * @param pairs The vector to append the pairs to
+         *
+         * Only the pairs with at least one proxy in @a proxyIds are reported,
+         * the cost is therefore proportional to the number of given proxies
+         * and not to the number of proxies in the hash. Each pair is reported
+         * exactly once and the pairs are appended in ascending order
+         */
+        void findPairs(const std::vector<int>& proxyIds, std::vector<Pair>& pairs) const;
+
+    private:
+        /**
+         * @brief The range of cells touched by a bounding box (inclusive)
+         */
+        struct CellRange {
+            int left = 0;
+            int top = 0;
+            int right = -1;
+            int bottom = -1;
+        };
+
+        /**
+         * @brief Proxy data
+         */
+        struct Proxy {
+            BoundingBox boundingBox; //!< The last bounding box of the proxy
+            CellRange range;         //!< The cells the proxy is registered in
+            bool isOversized;        //!< True if the proxy spans too many cells to be hashed
+            bool isInUse;            //!< True if the proxy id is registered
+        };
+
+        /**
+         * @brief Helper function for computing the cells touched by a bounding box
+         */
+        CellRange computeRange(const BoundingBox& boundingBox) const;
+
+        /**
+         * @brief Helper function for registering a proxy in the hash
+         */
+        void addProxy(int proxyId, Proxy& proxy);
+
+        /**
+         * @brief Helper function for unregistering a proxy from the hash
+         */
+        void removeProxy(int proxyId, Proxy& proxy);
+
+    private:
+        using CellKey = std::uint64_t;
+        float cellSize_;                                    //!< The width and height of a cell
+        std::unordered_map<CellKey, std::vector<int>> cells_; //!< Non-empty cells
+        std::vector<Proxy> proxies_;                        //!< Proxy data indexed by proxy id
+        std::vector<int> oversized_;                        //!< Proxies tested against every other proxy
+    };
+}
+
+#endif
@@ -24,6 +24,7 @@
 
 #include "Mighter2d/core/physics/TargetGridMover.h"
 #include "Mighter2d/core/physics/path/BFS.h"
+#include "Mighter2d/core/grid/FlowField.h"
 #include "Mighter2d/graphics/shapes/RectangleShape.h"
 #include "Mighter2d/graphics/RenderTarget.h"
 #include "Mighter2d/utility/Utils.h"
@@ -39,7 +40,11 @@ namespace mighter2d {
         movementStarted_{false},
         targetTileChangedWhileMoving_{false},
         isAdaptiveMoveEnabled_{false},
-        isPendingMove_{false}
+        isFlowFieldEnabled_{false},
+        isPendingMove_{false},
+        pathService_{nullptr},
+        pathServiceDestructionId_{-1},
+        pathRequestId_{-1}
     {
         MIGHTER2D_ASSERT((grid.getSizeInTiles() != Vector2u{0u, 0u}), "A target grid mover must be instantiated with a fully constructed grid")
 
@@ -64,7 +69,7 @@ namespace mighter2d {
         onMoveEnd([this](mighter2d::Index) {
             if (isPendingMove_)
                 isPendingMove_ = false;
-            else if (isAdaptiveMoveEnabled_)
+            else if (isAdaptiveMoveEnabled_ || isFlowFieldEnabled_)
                 generatePath();
             else {
                 if (targetTileChangedWhileMoving_) {
@@ -129,15 +134,16 @@ namespace mighter2d {
     }
 
     void TargetGridMover::clearPath() {
+        cancelPathRequest();
+
         while (!pathToTargetTile_.empty())
             pathToTargetTile_.pop();
     }
 
     bool TargetGridMover::isDestinationReachable(const Index& index) const {
         MIGHTER2D_ASSERT(getTarget(), "Cannot check destination reachability without a target")
-        return !(pathFinder_->findPath(getGrid(),
-            getGrid().getTileOccupiedByChild(getTarget()).getIndex(),
-            index).empty());
+        Index currentTile = getGrid().getTileOccupiedByChild(getTarget()).getIndex();
+        return currentTile != index && getGrid().isReachable(currentTile, index);
     }
 
     bool TargetGridMover::isDestinationReachable(const Vector2f &position) const {
@@ -163,6 +169,43 @@ namespace mighter2d {
         return pathFinder_->getType();
     }
 
+    void TargetGridMover::setPathCache(std::shared_ptr<PathCache> pathCache) {
+        pathCache_ = std::move(pathCache);
+    }
+
+    std::shared_ptr<PathCache> TargetGridMover::getPathCache() const {
+        return pathCache_;
+    }
+
+    void TargetGridMover::setPathService(PathService *pathService) {
+        if (pathService_ == pathService)
+            return;
+
+        if (pathService_) {
+            cancelPathRequest();
+            pathService_->removeDestructionListener(pathServiceDestructionId_);
+        }
+
+        pathService_ = pathService;
+
+        if (pathService_) {
+            pathServiceDestructionId_ = pathService_->onDestruction([this] {
+                pathService_ = nullptr;
+
+                // The path will never be delivered, find it here instead
+                if (pathRequestId_ != -1) {
+                    pathRequestId_ = -1;
+                    generatePath();
+                    moveTarget();
+                }
+            });
+        }
+    }
+
+    PathService *TargetGridMover::getPathService() const {
+        return pathService_;
+    }
+
     void TargetGridMover::setDestination(const Vector2f& position) {
         setDestination(getGrid().getTile(position).getIndex());
     }
@@ -214,13 +257,68 @@ namespace mighter2d {
 
     void TargetGridMover::generatePath() {
         if (getTarget()) {
-            pathToTargetTile_ = pathFinder_->findPath(getGrid(), getCurrentTileIndex(), targetTileIndex_);
+            if (isFlowFieldEnabled_) {
+                clearPath();
+                if (getGrid().isIndexValid(targetTileIndex_)) {
+                    Index nextTile = getGrid().getFlowField(targetTileIndex_).getNextTile(getCurrentTileIndex());
+                    if (nextTile != Index{-1, -1})
+                        pathToTargetTile_.push(nextTile);
+                }
+            } else if (pathService_) {
+                requestPath();
+                return;
+            } else
+                pathToTargetTile_ = findPath(getCurrentTileIndex(), targetTileIndex_);
 
             if (onPathGen_)
                 onPathGen_(pathToTargetTile_);
         }
     }
 
+    std::stack<Index> TargetGridMover::findPath(const Index &sourceTile, const Index &targetTile) const {
+        if (!pathCache_)
+            return pathFinder_->findPath(getGrid(), sourceTile, targetTile);
+
+        PathCache::Key key{sourceTile, targetTile, getMovementRestriction(), pathFinder_->getType(), pathFinder_->getSettings()};
+        if (const std::stack<Index>* path = pathCache_->find(getGrid(), key))
+            return *path;
+
+        std::stack<Index> path = pathFinder_->findPath(getGrid(), sourceTile, targetTile);
+        pathCache_->insert(getGrid(), key, path);
+        return path;
+    }
+
+    void TargetGridMover::requestPath() {
+        clearPath();
+
+        Index sourceTile = getCurrentTileIndex();
+        pathRequestId_ = pathService_->requestPath(sourceTile, targetTileIndex_, [this, sourceTile](const std::stack<Index>& path) {
+            pathRequestId_ = -1;
+
+            if (!getTarget())
+                return;
+
+            // The path is useless if the target left the tile it was requested from
+            if (getCurrentTileIndex() != sourceTile)
+                generatePath();
+            else {
+                pathToTargetTile_ = path;
+
+                if (onPathGen_)
+                    onPathGen_(pathToTargetTile_);
+            }
+
+            moveTarget();
+        });
+    }
+
+    void TargetGridMover::cancelPathRequest() {
+        if (pathRequestId_ != -1) {
+            pathService_->cancelRequest(pathRequestId_);
+            pathRequestId_ = -1;
+        }
+    }
+
     void TargetGridMover::moveTarget() {
         if (!pathToTargetTile_.empty() && getTarget()) {
             if (isTargetMoving()) {
@@ -245,6 +343,25 @@ namespace mighter2d {
         return isAdaptiveMoveEnabled_;
     }
 
+    void TargetGridMover::setFlowFieldEnable(bool enable) {
+        if (isFlowFieldEnabled_ == enable)
+            return;
+
+        isFlowFieldEnabled_ = enable;
+        emitChange(Property{"flowFieldEnable", isFlowFieldEnabled_});
+
+        if (isTargetMoving())
+            targetTileChangedWhileMoving_ = true; // Generate path using the new setting when target stops
+        else {
+            generatePath();
+            moveTarget();
+        }
+    }
+
+    bool TargetGridMover::isFlowFieldEnabled() const {
+        return isFlowFieldEnabled_;
+    }
+
     int TargetGridMover::onDestinationReached(Callback<Index> callback) {
         return onMoveEnd([this, callback = std::move(callback)](Index index) {
             if (targetTileIndex_ == index)
@@ -288,5 +405,10 @@ namespace mighter2d {
 
     TargetGridMover::~TargetGridMover() {
         emitDestruction();
+
+        if (pathService_) {
+            cancelPathRequest();
+            pathService_->removeDestructionListener(pathServiceDestructionId_);
+        }
     }
 }
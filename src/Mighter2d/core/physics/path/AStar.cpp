@@ -0,0 +1,68 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/physics/path/AStar.h"
+#include "Mighter2d/core/physics/path/AStarSearch.h"
+#include "Mighter2d/core/grid/Grid.h"
+
+namespace mighter2d {
+    AStar::AStar(const Vector2u& gridSize, Heuristic heuristic) :
+        heuristic_{heuristic},
+        search_{std::make_unique<priv::AStarSearch>(static_cast<std::size_t>(gridSize.x) * gridSize.y)},
+        expandedCount_{0}
+    {}
+
+    void AStar::setHeuristic(Heuristic heuristic) {
+        heuristic_ = heuristic;
+    }
+
+    AStar::Heuristic AStar::getHeuristic() const {
+        return heuristic_;
+    }
+
+    std::stack<Index> AStar::findPath(const Grid &grid, const Index &sourceTile, const Index &targetTile) {
+        expandedCount_ = 0;
+
+        if (sourceTile == targetTile || !grid.isReachable(sourceTile, targetTile))
+            return std::stack<Index>{};
+
+        std::stack<Index> path = search_->findPath(grid, sourceTile, targetTile, heuristic_ == Heuristic::Octile);
+        expandedCount_ = search_->getExpandedCount();
+        return path;
+    }
+
+    std::size_t AStar::getExpandedCount() const {
+        return expandedCount_;
+    }
+
+    std::string AStar::getType() const {
+        return "AStar";
+    }
+
+    std::string AStar::getSettings() const {
+        return heuristic_ == Heuristic::Octile ? "Octile" : "Manhattan";
+    }
+
+    AStar::~AStar() = default;
+}
@@ -0,0 +1,61 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+#include "Mighter2d/core/physics/path/AStarSearch.h"
+#include <algorithm>
+
+namespace mighter2d::priv {
+    AStarSearch::AStarSearch(std::size_t tileCount) :
+        searchId_{0},
+        expandedCount_{0}
+    {
+        resize(tileCount);
+    }
+
+    std::size_t AStarSearch::getExpandedCount() const {
+        return expandedCount_;
+    }
+
+    void AStarSearch::resize(std::size_t tileCount) {
+        if (gScores_.size() >= tileCount)
+            return;
+
+        gScores_.resize(tileCount);
+        parents_.resize(tileCount);
+        openedIn_.resize(tileCount, 0u);
+        closedIn_.resize(tileCount, 0u);
+    }
+
+    void AStarSearch::beginSearch(std::size_t tileCount) {
+        resize(tileCount);
+
+        // Tiles whose stamp is not the current search id are unvisited
+        if (++searchId_ == 0) {
+            std::fill(openedIn_.begin(), openedIn_.end(), 0u);
+            std::fill(closedIn_.begin(), closedIn_.end(), 0u);
+            searchId_ = 1;
+        }
+
+        openSet_.clear();
+    }
+}
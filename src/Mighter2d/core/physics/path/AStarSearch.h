@@ -0,0 +1,196 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+#ifndef MIGHTER2D_ASTARSEARCH_H
+#define MIGHTER2D_ASTARSEARCH_H
+
+#include "Mighter2d/Config.h"
+#include "Mighter2d/core/grid/Index.h"
+#include "Mighter2d/core/physics/path/PathCosts.h"
+#include <algorithm>
+#include <stack>
+#include <vector>
+
+namespace mighter2d::priv {
+    /**
+     * @brief The A* search shared by AStar and PathService
+     *
+     * The search reads the tiles through a tile map, which is either a
+     * Grid or a copy of its tiles. A tile map must provide the functions
+     * getSizeInTiles(), isIndexValid(const Index&),
+     * isTileAccessible(const Index&) and getMovementCost(const Index&)
+     * with the same meaning as their Grid counterparts.
+     *
+     * The search arrays are kept between searches, so an instance must
+     * not be used by more than one thread at a time
+     */
+    class AStarSearch {
+    public:
+        /**
+         * @brief Constructor
+         * @param tileCount The number of tiles to allocate the search arrays for
+         *
+         * The arrays grow on demand when a larger tile map is searched
+         */
+        explicit AStarSearch(std::size_t tileCount = 0);
+
+        /**
+         * @brief Find the cheapest path from a source tile to a target tile
+         * @param tileMap The tiles to search
+         * @param sourceTile The tile the path starts from
+         * @param targetTile The tile the path leads to
+         * @param isDiagonalAllowed True to allow diagonal moves, otherwise false
+         * @return The path from the source to the target if reachable,
+         *         otherwise an empty path
+         *
+         * A diagonal move costs sqrt(2) times the cost of the tile and it
+         * is only allowed if both tiles beside it can be entered
+         */
+        template <typename TileMap>
+        std::stack<Index> findPath(const TileMap& tileMap, const Index& sourceTile,
+            const Index& targetTile, bool isDiagonalAllowed);
+
+        /**
+         * @brief Get the number of tiles expanded by the last search
+         * @return The number of tiles expanded by the last call to findPath
+         */
+        std::size_t getExpandedCount() const;
+
+    private:
+        /**
+         * @brief A tile in the open set
+         */
+        struct OpenNode {
+            float fScore;      //!< The cost from the source plus the estimated cost to the target
+            float gScore;      //!< The cost from the source when the node was added
+            std::size_t tile;  //!< Row-major position of the tile
+        };
+
+        /**
+         * @brief Make the search arrays large enough for a tile map
+         * @param tileCount The number of tiles in the tile map
+         */
+        void resize(std::size_t tileCount);
+
+        /**
+         * @brief Prepare the search arrays for a new search
+         * @param tileCount The number of tiles in the tile map
+         */
+        void beginSearch(std::size_t tileCount);
+
+    private:
+        std::vector<float> gScores_;           //!< The cheapest known cost from the source to each tile
+        std::vector<std::size_t> parents_;     //!< The tile each tile is reached from on its cheapest known path
+        std::vector<unsigned int> openedIn_;   //!< The search in which each tile was last reached
+        std::vector<unsigned int> closedIn_;   //!< The search in which each tile was last expanded
+        std::vector<OpenNode> openSet_;        //!< Binary heap of the tiles to be expanded
+        unsigned int searchId_;                //!< Identifies the current search, so the arrays need not be cleared
+        std::size_t expandedCount_;            //!< The number of tiles expanded by the last search
+    };
+
+    template <typename TileMap>
+    std::stack<Index> AStarSearch::findPath(const TileMap& tileMap, const Index& sourceTile,
+        const Index& targetTile, bool isDiagonalAllowed)
+    {
+        // Moves in the order W, N, E, S followed by the diagonal moves NW, NE, SE, SW
+        static constexpr int ROW_OFFSETS[] = {0, -1, 0, 1, -1, -1, 1, 1};
+        static constexpr int COLM_OFFSETS[] = {-1, 0, 1, 0, -1, 1, 1, -1};
+
+        expandedCount_ = 0;
+
+        if (sourceTile == targetTile || !tileMap.isIndexValid(sourceTile) || !tileMap.isTileAccessible(targetTile))
+            return std::stack<Index>{};
+
+        const auto colms = static_cast<std::size_t>(tileMap.getSizeInTiles().x);
+        beginSearch(colms * tileMap.getSizeInTiles().y);
+
+        auto isBetter = [](const OpenNode& lhs, const OpenNode& rhs) {
+            // Inverted for a min-heap, ties are broken in favour of the node closer to the target
+            return lhs.fScore > rhs.fScore || (lhs.fScore == rhs.fScore && lhs.gScore < rhs.gScore);
+        };
+
+        auto estimate = [&targetTile, isDiagonalAllowed](int row, int colm) {
+            return getDistanceCost(row - targetTile.row, colm - targetTile.colm, isDiagonalAllowed);
+        };
+
+        const std::size_t source = static_cast<std::size_t>(sourceTile.row) * colms + static_cast<std::size_t>(sourceTile.colm);
+        const std::size_t target = static_cast<std::size_t>(targetTile.row) * colms + static_cast<std::size_t>(targetTile.colm);
+        const int moveCount = isDiagonalAllowed ? 8 : 4;
+
+        gScores_[source] = 0.0f;
+        parents_[source] = source;
+        openedIn_[source] = searchId_;
+        openSet_.push_back({estimate(sourceTile.row, sourceTile.colm), 0.0f, source});
+
+        while (!openSet_.empty()) {
+            std::pop_heap(openSet_.begin(), openSet_.end(), isBetter);
+            OpenNode node = openSet_.back();
+            openSet_.pop_back();
+
+            // A tile is pushed again when a cheaper path to it is found, skip the outdated entries
+            if (closedIn_[node.tile] == searchId_ || node.gScore > gScores_[node.tile])
+                continue;
+
+            closedIn_[node.tile] = searchId_;
+            expandedCount_++;
+
+            if (node.tile == target) {
+                std::stack<Index> path;
+                for (auto tile = target; tile != source; tile = parents_[tile])
+                    path.push(Index{static_cast<int>(tile / colms), static_cast<int>(tile % colms)});
+
+                return path;
+            }
+
+            const int row = static_cast<int>(node.tile / colms);
+            const int colm = static_cast<int>(node.tile % colms);
+
+            for (int move = 0; move < moveCount; ++move) {
+                const Index neighbour{row + ROW_OFFSETS[move], colm + COLM_OFFSETS[move]};
+                if (!tileMap.isIndexValid(neighbour))
+                    continue;
+
+                const std::size_t tile = static_cast<std::size_t>(neighbour.row) * colms + static_cast<std::size_t>(neighbour.colm);
+                if (closedIn_[tile] == searchId_ || !tileMap.isTileAccessible(neighbour))
+                    continue;
+
+                const bool isDiagonal = move >= 4;
+                if (isDiagonal && (!tileMap.isTileAccessible({row, neighbour.colm}) || !tileMap.isTileAccessible({neighbour.row, colm})))
+                    continue;
+
+                float gScore = node.gScore + tileMap.getMovementCost(neighbour) * (isDiagonal ? DIAGONAL_COST : 1.0f);
+                if (openedIn_[tile] != searchId_ || gScore < gScores_[tile]) {
+                    openedIn_[tile] = searchId_;
+                    gScores_[tile] = gScore;
+                    parents_[tile] = node.tile;
+                    openSet_.push_back({gScore + estimate(neighbour.row, neighbour.colm), gScore, tile});
+                    std::push_heap(openSet_.begin(), openSet_.end(), isBetter);
+                }
+            }
+        }
+
+        return std::stack<Index>{};
+    }
+}
+
+#endif // MIGHTER2D_ASTARSEARCH_H
@@ -23,55 +23,143 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Mighter2d/core/physics/path/AdjacencyList.h"
-#include "Mighter2d/core/object/GridObject.h"
 #include "Mighter2d/core/grid/Grid.h"
 
 namespace mighter2d {
-    namespace {
-        bool tileHasObstacle(const Grid& grid, Index index) {
-            bool hasObstacle = false;
-            grid.forEachChildInTile(grid.getTile(index), [&hasObstacle](const GridObject* child) {
-                if (child->isObstacle() && child->isActive()) {
-                    hasObstacle = true;
-                    return;
-                }
-            });
-            return hasObstacle;
+    AdjacencyList::AdjacencyList() :
+        rows_{0},
+        colms_{0},
+        gridId_{-1},
+        version_{0},
+        streamedGrid_{nullptr}
+    {}
+
+    void AdjacencyList::generateFrom(const Grid &grid) {
+        auto rows = static_cast<int>(grid.getSizeInTiles().y);
+        auto colms = static_cast<int>(grid.getSizeInTiles().x);
+
+        if (grid.isStreamed()) {
+            streamedGrid_ = &grid;
+            rows_ = rows;
+            colms_ = colms;
+            gridId_ = -1;
+            neighbours_ = std::vector<Index>{};
+            degrees_ = std::vector<unsigned char>{};
+            accessible_ = std::vector<unsigned char>{};
+            return;
+        }
+
+        streamedGrid_ = nullptr;
+
+        if (gridId_ != static_cast<int>(grid.getObjectId()) || rows_ != rows || colms_ != colms)
+            rebuild(grid);
+        else if (version_ != grid.getVersion()) {
+            if (grid.getChangedTiles(version_, changedTiles_)) {
+                for (const auto& index : changedTiles_)
+                    patch(grid, index);
+
+                version_ = grid.getVersion();
+            } else
+                rebuild(grid);
         }
     }
 
-    void AdjacencyList::generateFrom(const Grid &grid) {
-        adjacencyList_.clear();
-        auto static addNeighbour = [](const Grid& grid2D, std::vector<Index>& neighboursVec, int row, int colm) {
-            if (grid2D.isIndexValid({row, colm})
-                && !grid2D.getTile(Index{row, colm}).isCollidable()
-                && !tileHasObstacle(grid2D, Index{row, colm}))
-            {
-                neighboursVec.push_back({row, colm});
-            }
-        };
-
-        for (auto i = 0; i < static_cast<int>(grid.getSizeInTiles().y); i++) {
-            for (auto j = 0 ; j < static_cast<int>(grid.getSizeInTiles().x); j++) {
-                if (grid.getTile(Index{i, j}).isCollidable() || tileHasObstacle(grid, Index{i, j}))
-                    continue;
-
-                std::vector<Index> neighbours;
-                addNeighbour(grid, neighbours, i - 1, j); //Left neighbour
-                addNeighbour(grid, neighbours, i, j - 1); //Top neighbour
-                addNeighbour(grid, neighbours, i + 1, j); //Right neighbour
-                addNeighbour(grid, neighbours, i, j + 1); //Bottom neighbour
-                adjacencyList_.push_back({{i, j}, neighbours});
-            }
+    AdjacencyList::Neighbours AdjacencyList::getNeighbours(const Index &index) const {
+        if (index.row < 0 || index.row >= rows_ || index.colm < 0 || index.colm >= colms_)
+            return Neighbours{nullptr, nullptr};
+
+        if (streamedGrid_)
+            return findStreamedNeighbours(index);
+
+        auto tile = static_cast<std::size_t>(index.row) * colms_ + index.colm;
+        const Index* first = neighbours_.data() + tile * MAX_NEIGHBOURS;
+        return Neighbours{first, first + degrees_[tile]};
+    }
+
+    void AdjacencyList::rebuild(const Grid &grid) {
+        gridId_ = static_cast<int>(grid.getObjectId());
+        version_ = grid.getVersion();
+        rows_ = static_cast<int>(grid.getSizeInTiles().y);
+        colms_ = static_cast<int>(grid.getSizeInTiles().x);
+
+        auto numOfTiles = static_cast<std::size_t>(rows_) * colms_;
+        neighbours_.assign(numOfTiles * MAX_NEIGHBOURS, Index{});
+        degrees_.assign(numOfTiles, 0);
+        accessible_.resize(numOfTiles);
+
+        for (auto i = 0; i < rows_; i++) {
+            for (auto j = 0; j < colms_; j++)
+                accessible_[static_cast<std::size_t>(i) * colms_ + j] = grid.isTileAccessible(Index{i, j});
+        }
+
+        for (auto i = 0; i < rows_; i++) {
+            for (auto j = 0; j < colms_; j++)
+                updateNeighbours(Index{i, j});
         }
     }
 
-    const std::vector<Index>& AdjacencyList::getNeighbours(const Index &index) const {
-        for (const auto& collection : adjacencyList_) {
-            const auto& [tile, neighbours] = collection;
-            if (tile.row == index.row && tile.colm == index.colm)
-                return neighbours;
+    void AdjacencyList::patch(const Grid& grid, const Index &index) {
+        if (index.row < 0 || index.row >= rows_ || index.colm < 0 || index.colm >= colms_)
+            return;
+
+        auto tile = static_cast<std::size_t>(index.row) * colms_ + index.colm;
+        bool accessible = grid.isTileAccessible(index);
+        if (static_cast<bool>(accessible_[tile]) == accessible)
+            return;
+
+        accessible_[tile] = accessible;
+
+        // The tile is in the neighbours of its neighbours
+        updateNeighbours(index);
+        updateNeighbours(Index{index.row - 1, index.colm});
+        updateNeighbours(Index{index.row, index.colm - 1});
+        updateNeighbours(Index{index.row + 1, index.colm});
+        updateNeighbours(Index{index.row, index.colm + 1});
+    }
+
+    void AdjacencyList::updateNeighbours(const Index &index) {
+        if (index.row < 0 || index.row >= rows_ || index.colm < 0 || index.colm >= colms_)
+            return;
+
+        auto tile = static_cast<std::size_t>(index.row) * colms_ + index.colm;
+        unsigned char degree = 0;
+
+        if (accessible_[tile]) {
+            Index* neighbours = neighbours_.data() + tile * MAX_NEIGHBOURS;
+            auto addNeighbour = [this, neighbours, &degree](int row, int colm) {
+                if (isAccessible(row, colm))
+                    neighbours[degree++] = Index{row, colm};
+            };
+
+            addNeighbour(index.row - 1, index.colm); //Left neighbour
+            addNeighbour(index.row, index.colm - 1); //Top neighbour
+            addNeighbour(index.row + 1, index.colm); //Right neighbour
+            addNeighbour(index.row, index.colm + 1); //Bottom neighbour
+        }
+
+        degrees_[tile] = degree;
+    }
+
+    AdjacencyList::Neighbours AdjacencyList::findStreamedNeighbours(const Index &index) const {
+        std::size_t degree = 0;
+
+        if (streamedGrid_->isTileAccessible(index)) {
+            auto addNeighbour = [this, &degree](const Index& neighbour) {
+                if (streamedGrid_->isTileAccessible(neighbour))
+                    streamedNeighbours_[degree++] = neighbour;
+            };
+
+            addNeighbour(Index{index.row - 1, index.colm}); //Left neighbour
+            addNeighbour(Index{index.row, index.colm - 1}); //Top neighbour
+            addNeighbour(Index{index.row + 1, index.colm}); //Right neighbour
+            addNeighbour(Index{index.row, index.colm + 1}); //Bottom neighbour
         }
-        return emptyVec;
+
+        return Neighbours{streamedNeighbours_, streamedNeighbours_ + degree};
+    }
+
+    bool AdjacencyList::isAccessible(int row, int colm) const {
+        return row >= 0 && row < rows_ && colm >= 0 && colm < colms_
+            && accessible_[static_cast<std::size_t>(row) * colms_ + colm];
     }
 }
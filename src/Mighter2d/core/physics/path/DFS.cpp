@@ -32,8 +32,7 @@ namespace mighter2d {
 
     std::stack<Index>
     DFS::findPath(const Grid &grid, const Index& sourceTile, const Index& targetTile) {
-        if (sourceTile == targetTile || !grid.isIndexValid(sourceTile)
-            || !grid.isIndexValid(targetTile))
+        if (sourceTile == targetTile || !grid.isReachable(sourceTile, targetTile))
             return std::stack<Index>{};
 
         adjacencyList_.generateFrom(grid);
@@ -0,0 +1,568 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/physics/path/HPAStar.h"
+#include "Mighter2d/core/grid/Grid.h"
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+
+namespace mighter2d {
+    namespace {
+        constexpr float UNREACHABLE = std::numeric_limits<float>::max();
+
+        // Openings on a cluster border at least this wide get an entrance at both ends instead of one in the middle
+        constexpr int MIN_DOUBLE_ENTRANCE_WIDTH = 6;
+
+        // Moves in the order W, N, E, S
+        constexpr int ROW_OFFSETS[] = {0, -1, 0, 1};
+        constexpr int COLM_OFFSETS[] = {-1, 0, 1, 0};
+
+        // Inverted for a min-heap, ties are broken in favour of the node closer to the target
+        constexpr auto isBetter = [](const auto& lhs, const auto& rhs) {
+            return lhs.fScore > rhs.fScore || (lhs.fScore == rhs.fScore && lhs.gScore < rhs.gScore);
+        };
+    }
+
+    HPAStar::HPAStar(const Vector2u& gridSize, unsigned int clusterSize) :
+        clusterSize_{static_cast<int>(std::max(clusterSize, 1u))},
+        grid_{nullptr},
+        gridId_{-1},
+        version_{0},
+        rows_{0},
+        colms_{0},
+        clusterRows_{0},
+        clusterColms_{0},
+        loadedCluster_{0},
+        searchId_{0},
+        expandedCount_{0}
+    {
+        const auto clusterTileCount = static_cast<std::size_t>(clusterSize_) * static_cast<std::size_t>(clusterSize_);
+        accessible_.reserve(static_cast<std::size_t>(gridSize.x) * gridSize.y);
+        localAccessible_.resize(clusterTileCount);
+        localMoveCosts_.resize(clusterTileCount);
+        localCosts_.resize(clusterTileCount);
+        localParents_.resize(clusterTileCount);
+    }
+
+    unsigned int HPAStar::getClusterSize() const {
+        return static_cast<unsigned int>(clusterSize_);
+    }
+
+    std::stack<Index> HPAStar::findPath(const Grid &grid, const Index &sourceTile, const Index &targetTile) {
+        expandedCount_ = 0;
+
+        if (sourceTile == targetTile || !grid.isReachable(sourceTile, targetTile))
+            return std::stack<Index>{};
+
+        grid_ = &grid;
+        loadedCluster_ = std::numeric_limits<std::size_t>::max();
+        update(grid);
+
+        std::stack<Index> path;
+        if (!isAccessible(targetTile.row, targetTile.colm)) {
+            grid_ = nullptr;
+            return path;
+        }
+
+        const auto colms = static_cast<std::size_t>(colms_);
+        const std::size_t tileCount = static_cast<std::size_t>(rows_) * colms;
+        const std::size_t source = static_cast<std::size_t>(sourceTile.row) * colms + static_cast<std::size_t>(sourceTile.colm);
+        const std::size_t target = static_cast<std::size_t>(targetTile.row) * colms + static_cast<std::size_t>(targetTile.colm);
+        const std::size_t sourceCluster = getCluster(sourceTile.row, sourceTile.colm);
+        const std::size_t targetCluster = getCluster(targetTile.row, targetTile.colm);
+
+        // The source and the target are connected to the entrances of their clusters for the duration of the search
+        const std::size_t sourceNode = nodeTiles_.size();
+        const std::size_t targetNode = sourceNode + 1;
+
+        searchCluster(sourceCluster, source, tileCount, false);
+        sourceCosts_.clear();
+        for (auto entrance : clusters_[sourceCluster].entrances)
+            sourceCosts_.push_back(localCosts_[getLocalIndex(static_cast<int>(entrance / colms), static_cast<int>(entrance % colms))]);
+
+        const float sourceToTargetCost = sourceCluster == targetCluster ? localCosts_[getLocalIndex(targetTile.row, targetTile.colm)] : UNREACHABLE;
+
+        searchCluster(targetCluster, target, tileCount, true);
+        targetCosts_.clear();
+        for (auto entrance : clusters_[targetCluster].entrances)
+            targetCosts_.push_back(localCosts_[getLocalIndex(static_cast<int>(entrance / colms), static_cast<int>(entrance % colms))]);
+
+        if (gScores_.size() < targetNode + 1) {
+            gScores_.resize(targetNode + 1);
+            parents_.resize(targetNode + 1);
+            openedIn_.resize(targetNode + 1, 0u);
+            closedIn_.resize(targetNode + 1, 0u);
+        }
+
+        // Nodes whose stamp is not the current search id are unvisited
+        if (++searchId_ == 0) {
+            std::fill(openedIn_.begin(), openedIn_.end(), 0u);
+            std::fill(closedIn_.begin(), closedIn_.end(), 0u);
+            searchId_ = 1;
+        }
+
+        auto estimate = [&targetTile, colms](std::size_t tile) {
+            return static_cast<float>(std::abs(static_cast<int>(tile / colms) - targetTile.row)
+                + std::abs(static_cast<int>(tile % colms) - targetTile.colm));
+        };
+
+        openSet_.clear();
+        gScores_[sourceNode] = 0.0f;
+        parents_[sourceNode] = sourceNode;
+        openedIn_[sourceNode] = searchId_;
+        openSet_.push_back({estimate(source), 0.0f, sourceNode});
+
+        while (!openSet_.empty()) {
+            std::pop_heap(openSet_.begin(), openSet_.end(), isBetter);
+            OpenNode current = openSet_.back();
+            openSet_.pop_back();
+
+            // A node is pushed again when a cheaper path to it is found, skip the outdated entries
+            if (closedIn_[current.node] == searchId_ || current.gScore > gScores_[current.node])
+                continue;
+
+            closedIn_[current.node] = searchId_;
+            expandedCount_++;
+
+            if (current.node == targetNode)
+                break;
+
+            auto addNode = [&](std::size_t node, std::size_t tile, float cost) {
+                if (cost == UNREACHABLE || closedIn_[node] == searchId_)
+                    return;
+
+                float gScore = current.gScore + cost;
+                if (openedIn_[node] != searchId_ || gScore < gScores_[node]) {
+                    openedIn_[node] = searchId_;
+                    gScores_[node] = gScore;
+                    parents_[node] = current.node;
+                    openSet_.push_back({gScore + estimate(tile), gScore, node});
+                    std::push_heap(openSet_.begin(), openSet_.end(), isBetter);
+                }
+            };
+
+            const std::size_t tile = current.node == sourceNode ? source : nodeTiles_[current.node];
+            const int row = static_cast<int>(tile / colms);
+            const int colm = static_cast<int>(tile % colms);
+            const std::size_t cluster = getCluster(row, colm);
+            const auto& entrances = clusters_[cluster].entrances;
+
+            // Edges inside the cluster
+            if (current.node == sourceNode) {
+                for (std::size_t i = 0; i < entrances.size(); ++i)
+                    addNode(firstNodes_[cluster] + i, entrances[i], sourceCosts_[i]);
+
+                addNode(targetNode, target, sourceToTargetCost);
+            } else {
+                const std::size_t slot = current.node - firstNodes_[cluster];
+                for (std::size_t i = 0; i < entrances.size(); ++i) {
+                    if (i != slot)
+                        addNode(firstNodes_[cluster] + i, entrances[i], clusters_[cluster].costs[slot * entrances.size() + i]);
+                }
+
+                if (cluster == targetCluster)
+                    addNode(targetNode, target, targetCosts_[slot]);
+            }
+
+            // Edges across the borders of the cluster
+            for (int move = 0; move < 4; ++move) {
+                const int neighbourRow = row + ROW_OFFSETS[move];
+                const int neighbourColm = colm + COLM_OFFSETS[move];
+                if (!isAccessible(neighbourRow, neighbourColm) || getCluster(neighbourRow, neighbourColm) == cluster)
+                    continue;
+
+                const std::size_t neighbour = static_cast<std::size_t>(neighbourRow) * colms + static_cast<std::size_t>(neighbourColm);
+                const std::size_t neighbourCluster = getCluster(neighbourRow, neighbourColm);
+                const float cost = grid.getMovementCost(Index{neighbourRow, neighbourColm});
+
+                if (neighbour == target)
+                    addNode(targetNode, target, cost);
+                else if (current.node == sourceNode) {
+                    // The source may not be an entrance (e.g. it contains the obstacle looking for a path),
+                    // so it is connected to the entrances of the neighbouring cluster through the neighbour
+                    searchCluster(neighbourCluster, neighbour, tileCount, false);
+
+                    const auto& neighbourEntrances = clusters_[neighbourCluster].entrances;
+                    for (std::size_t i = 0; i < neighbourEntrances.size(); ++i) {
+                        const float localCost = localCosts_[getLocalIndex(static_cast<int>(neighbourEntrances[i] / colms), static_cast<int>(neighbourEntrances[i] % colms))];
+                        addNode(firstNodes_[neighbourCluster] + i, neighbourEntrances[i], localCost == UNREACHABLE ? UNREACHABLE : cost + localCost);
+                    }
+
+                    if (neighbourCluster == targetCluster && localCosts_[getLocalIndex(targetTile.row, targetTile.colm)] != UNREACHABLE)
+                        addNode(targetNode, target, cost + localCosts_[getLocalIndex(targetTile.row, targetTile.colm)]);
+                } else if (entranceSlots_[neighbour] >= 0)
+                    addNode(firstNodes_[neighbourCluster] + static_cast<std::size_t>(entranceSlots_[neighbour]), neighbour, cost);
+            }
+        }
+
+        if (closedIn_[targetNode] == searchId_) {
+            std::vector<std::size_t> waypoints;
+            for (auto node = targetNode; node != sourceNode; node = parents_[node])
+                waypoints.push_back(node == targetNode ? target : nodeTiles_[node]);
+
+            waypoints.push_back(source);
+
+            // Find the tiles between consecutive waypoints, the path is built from the target backwards
+            std::vector<std::size_t> segment;
+            for (std::size_t i = 0; i + 1 < waypoints.size(); ++i) {
+                const std::size_t to = waypoints[i];
+                const std::size_t from = waypoints[i + 1];
+                const int toRow = static_cast<int>(to / colms);
+                const int toColm = static_cast<int>(to % colms);
+                const std::size_t cluster = getCluster(toRow, toColm);
+
+                const int fromRow = static_cast<int>(from / colms);
+                const int fromColm = static_cast<int>(from % colms);
+                std::size_t start = from;
+
+                if (to == from)
+                    continue;
+                else if (cluster != getCluster(fromRow, fromColm)) {
+                    if (std::abs(toRow - fromRow) + std::abs(toColm - fromColm) == 1) {
+                        path.push(Index{toRow, toColm});
+                        continue;
+                    }
+
+                    // Only the source is connected to entrances further than its neighbour in another cluster
+                    for (int move = 0; move < 4; ++move) {
+                        const int neighbourRow = fromRow + ROW_OFFSETS[move];
+                        const int neighbourColm = fromColm + COLM_OFFSETS[move];
+
+                        if (isAccessible(neighbourRow, neighbourColm) && getCluster(neighbourRow, neighbourColm) == cluster) {
+                            start = static_cast<std::size_t>(neighbourRow) * colms + static_cast<std::size_t>(neighbourColm);
+                            break;
+                        }
+                    }
+                }
+
+                searchCluster(cluster, start, to, false);
+
+                const int firstRow = toRow - toRow % clusterSize_;
+                const int firstColm = toColm - toColm % clusterSize_;
+                const auto startIndex = static_cast<int>(getLocalIndex(static_cast<int>(start / colms), static_cast<int>(start % colms)));
+                for (auto index = static_cast<int>(getLocalIndex(toRow, toColm)); index != startIndex; index = localParents_[static_cast<std::size_t>(index)])
+                    path.push(Index{firstRow + index / clusterSize_, firstColm + index % clusterSize_});
+
+                if (start != from)
+                    path.push(Index{static_cast<int>(start / colms), static_cast<int>(start % colms)});
+            }
+        }
+
+        grid_ = nullptr;
+        return path;
+    }
+
+    void HPAStar::update(const Grid& grid) {
+        const auto rows = static_cast<int>(grid.getSizeInTiles().y);
+        const auto colms = static_cast<int>(grid.getSizeInTiles().x);
+        bool isRebuildRequired = false;
+
+        if (gridId_ != static_cast<int>(grid.getObjectId()) || rows_ != rows || colms_ != colms) {
+            gridId_ = static_cast<int>(grid.getObjectId());
+            rows_ = rows;
+            colms_ = colms;
+            clusterRows_ = (rows + clusterSize_ - 1) / clusterSize_;
+            clusterColms_ = (colms + clusterSize_ - 1) / clusterSize_;
+
+            const auto clusterCount = static_cast<std::size_t>(clusterRows_) * clusterColms_;
+            accessible_.assign(static_cast<std::size_t>(rows) * colms, 0);
+            entranceSlots_.assign(accessible_.size(), -1);
+            clusters_.assign(clusterCount, Cluster{});
+            isClusterDirty_.assign(clusterCount, 0);
+            dirtyClusters_.clear();
+            isRebuildRequired = true;
+        } else if (version_ != grid.getVersion()) {
+            if (grid.getChangedTiles(version_, changedTiles_)) {
+                for (const auto& index : changedTiles_) {
+                    if (!grid.isIndexValid(index))
+                        continue;
+
+                    auto& accessible = accessible_[static_cast<std::size_t>(index.row) * colms_ + index.colm];
+                    const bool isNowAccessible = grid.isTileAccessible(index);
+                    if (static_cast<bool>(accessible) != isNowAccessible) {
+                        accessible = isNowAccessible;
+                        markTileDirty(index.row, index.colm);
+                    }
+                }
+            } else
+                isRebuildRequired = true; // Changes affecting the whole grid (such as movement costs) are not recorded per tile
+        }
+
+        version_ = grid.getVersion();
+
+        if (isRebuildRequired) {
+            for (int row = 0; row < rows_; ++row) {
+                for (int colm = 0; colm < colms_; ++colm)
+                    accessible_[static_cast<std::size_t>(row) * colms_ + colm] = grid.isTileAccessible(Index{row, colm});
+            }
+
+            for (std::size_t cluster = 0; cluster < clusters_.size(); ++cluster)
+                markDirty(cluster);
+        }
+
+        rebuildDirtyClusters();
+    }
+
+    void HPAStar::markDirty(std::size_t cluster) {
+        if (!isClusterDirty_[cluster]) {
+            isClusterDirty_[cluster] = 1;
+            dirtyClusters_.push_back(cluster);
+        }
+    }
+
+    void HPAStar::markTileDirty(int row, int colm) {
+        markDirty(getCluster(row, colm));
+
+        // A tile on a border also changes the entrances of the cluster on the other side
+        if (colm % clusterSize_ == 0 && colm > 0)
+            markDirty(getCluster(row, colm - 1));
+
+        if (colm % clusterSize_ == clusterSize_ - 1 && colm + 1 < colms_)
+            markDirty(getCluster(row, colm + 1));
+
+        if (row % clusterSize_ == 0 && row > 0)
+            markDirty(getCluster(row - 1, colm));
+
+        if (row % clusterSize_ == clusterSize_ - 1 && row + 1 < rows_)
+            markDirty(getCluster(row + 1, colm));
+    }
+
+    void HPAStar::rebuildDirtyClusters() {
+        if (dirtyClusters_.empty())
+            return;
+
+        const auto colms = static_cast<std::size_t>(colms_);
+        const std::size_t tileCount = static_cast<std::size_t>(rows_) * colms;
+
+        // The entrances of a cluster depend on its neighbours, so they are all removed before any is found again
+        for (auto cluster : dirtyClusters_) {
+            for (auto entrance : clusters_[cluster].entrances)
+                entranceSlots_[entrance] = -1;
+        }
+
+        for (auto cluster : dirtyClusters_)
+            findEntrances(cluster);
+
+        for (auto cluster : dirtyClusters_) {
+            auto& entrances = clusters_[cluster].entrances;
+            auto& costs = clusters_[cluster].costs;
+            costs.assign(entrances.size() * entrances.size(), UNREACHABLE);
+
+            for (std::size_t i = 0; i < entrances.size(); ++i) {
+                searchCluster(cluster, entrances[i], tileCount, false);
+
+                for (std::size_t j = 0; j < entrances.size(); ++j)
+                    costs[i * entrances.size() + j] = localCosts_[getLocalIndex(static_cast<int>(entrances[j] / colms), static_cast<int>(entrances[j] % colms))];
+            }
+
+            isClusterDirty_[cluster] = 0;
+        }
+
+        dirtyClusters_.clear();
+
+        // Number the entrances of all the clusters consecutively
+        firstNodes_.resize(clusters_.size());
+        nodeTiles_.clear();
+        for (std::size_t cluster = 0; cluster < clusters_.size(); ++cluster) {
+            firstNodes_[cluster] = nodeTiles_.size();
+            nodeTiles_.insert(nodeTiles_.end(), clusters_[cluster].entrances.begin(), clusters_[cluster].entrances.end());
+        }
+    }
+
+    void HPAStar::findEntrances(std::size_t cluster) {
+        const int clusterRow = static_cast<int>(cluster) / clusterColms_;
+        const int clusterColm = static_cast<int>(cluster) % clusterColms_;
+        const int firstRow = clusterRow * clusterSize_;
+        const int firstColm = clusterColm * clusterSize_;
+        const int height = std::min(clusterSize_, rows_ - firstRow);
+        const int width = std::min(clusterSize_, colms_ - firstColm);
+
+        std::vector<std::size_t> borderEntrances;
+        if (clusterColm > 0)
+            findBorderEntrances(firstRow, firstColm - 1, height, true, false, borderEntrances);
+
+        if (clusterColm + 1 < clusterColms_)
+            findBorderEntrances(firstRow, firstColm + width - 1, height, true, true, borderEntrances);
+
+        if (clusterRow > 0)
+            findBorderEntrances(firstRow - 1, firstColm, width, false, false, borderEntrances);
+
+        if (clusterRow + 1 < clusterRows_)
+            findBorderEntrances(firstRow + height - 1, firstColm, width, false, true, borderEntrances);
+
+        // A corner tile may be an entrance on two borders
+        auto& entrances = clusters_[cluster].entrances;
+        entrances.clear();
+        for (auto tile : borderEntrances) {
+            if (entranceSlots_[tile] < 0) {
+                entranceSlots_[tile] = static_cast<int>(entrances.size());
+                entrances.push_back(tile);
+            }
+        }
+    }
+
+    void HPAStar::findBorderEntrances(int firstRow, int firstColm, int length, bool isVertical,
+        bool isNearSide, std::vector<std::size_t>& entrances) const
+    {
+        const int rowStep = isVertical ? 1 : 0;
+        const int colmStep = isVertical ? 0 : 1;
+        const int farRowOffset = isVertical ? 0 : 1;
+        const int farColmOffset = isVertical ? 1 : 0;
+
+        auto addEntrance = [&](int position) {
+            const int row = firstRow + rowStep * position + (isNearSide ? 0 : farRowOffset);
+            const int colm = firstColm + colmStep * position + (isNearSide ? 0 : farColmOffset);
+            entrances.push_back(static_cast<std::size_t>(row) * colms_ + static_cast<std::size_t>(colm));
+        };
+
+        // An opening is a run of tiles that can be entered on both sides of the border
+        int openingStart = -1;
+        for (int position = 0; position <= length; ++position) {
+            const int row = firstRow + rowStep * position;
+            const int colm = firstColm + colmStep * position;
+            const bool isOpen = position < length && isAccessible(row, colm) && isAccessible(row + farRowOffset, colm + farColmOffset);
+
+            if (isOpen && openingStart < 0)
+                openingStart = position;
+            else if (!isOpen && openingStart >= 0) {
+                const int openingEnd = position - 1;
+                if (openingEnd - openingStart + 1 >= MIN_DOUBLE_ENTRANCE_WIDTH) {
+                    addEntrance(openingStart);
+                    addEntrance(openingEnd);
+                } else
+                    addEntrance((openingStart + openingEnd) / 2);
+
+                openingStart = -1;
+            }
+        }
+    }
+
+    void HPAStar::loadCluster(std::size_t cluster) {
+        if (loadedCluster_ == cluster)
+            return;
+
+        loadedCluster_ = cluster;
+        const int firstRow = static_cast<int>(cluster) / clusterColms_ * clusterSize_;
+        const int firstColm = static_cast<int>(cluster) % clusterColms_ * clusterSize_;
+
+        // The positions of a cluster on the bottom or right edge of the grid that are outside the grid cannot be entered
+        for (int row = 0; row < clusterSize_; ++row) {
+            for (int colm = 0; colm < clusterSize_; ++colm) {
+                const auto index = static_cast<std::size_t>(row * clusterSize_ + colm);
+                localAccessible_[index] = isAccessible(firstRow + row, firstColm + colm);
+                localMoveCosts_[index] = localAccessible_[index] ? grid_->getMovementCost(Index{firstRow + row, firstColm + colm}) : 0.0f;
+            }
+        }
+    }
+
+    void HPAStar::searchCluster(std::size_t cluster, std::size_t tile, std::size_t target, bool isReversed) {
+        loadCluster(cluster);
+
+        const auto colms = static_cast<std::size_t>(colms_);
+        const std::size_t tileCount = static_cast<std::size_t>(rows_) * colms;
+        const auto start = static_cast<int>(getLocalIndex(static_cast<int>(tile / colms), static_cast<int>(tile % colms)));
+        const int stop = target < tileCount ? static_cast<int>(getLocalIndex(static_cast<int>(target / colms), static_cast<int>(target % colms))) : -1;
+
+        std::fill(localCosts_.begin(), localCosts_.end(), UNREACHABLE);
+        localCosts_[static_cast<std::size_t>(start)] = 0.0f;
+        localParents_[static_cast<std::size_t>(start)] = start;
+
+        auto isCheaper = [](const LocalNode& lhs, const LocalNode& rhs) {
+            return lhs.priority > rhs.priority || (lhs.priority == rhs.priority && lhs.cost < rhs.cost);
+        };
+
+        const int stopRow = stop / clusterSize_;
+        const int stopColm = stop % clusterSize_;
+        auto estimate = [stop, stopRow, stopColm](int row, int colm) {
+            return stop < 0 ? 0.0f : static_cast<float>(std::abs(row - stopRow) + std::abs(colm - stopColm));
+        };
+
+        localOpenSet_.clear();
+        localOpenSet_.push_back({0.0f, 0.0f, start});
+
+        while (!localOpenSet_.empty()) {
+            std::pop_heap(localOpenSet_.begin(), localOpenSet_.end(), isCheaper);
+            LocalNode current = localOpenSet_.back();
+            localOpenSet_.pop_back();
+
+            if (current.cost > localCosts_[static_cast<std::size_t>(current.index)])
+                continue;
+            else if (current.index == stop)
+                return;
+
+            const int row = current.index / clusterSize_;
+            const int colm = current.index % clusterSize_;
+
+            for (int move = 0; move < 4; ++move) {
+                const int neighbourRow = row + ROW_OFFSETS[move];
+                const int neighbourColm = colm + COLM_OFFSETS[move];
+                if (neighbourRow < 0 || neighbourRow >= clusterSize_ || neighbourColm < 0 || neighbourColm >= clusterSize_)
+                    continue;
+
+                const int neighbour = neighbourRow * clusterSize_ + neighbourColm;
+                if (!localAccessible_[static_cast<std::size_t>(neighbour)])
+                    continue;
+
+                // A reversed search finds the cost of moving from the neighbour into the current tile
+                const float cost = current.cost + localMoveCosts_[static_cast<std::size_t>(isReversed ? current.index : neighbour)];
+                if (cost < localCosts_[static_cast<std::size_t>(neighbour)]) {
+                    localCosts_[static_cast<std::size_t>(neighbour)] = cost;
+                    localParents_[static_cast<std::size_t>(neighbour)] = current.index;
+                    localOpenSet_.push_back({cost + estimate(neighbourRow, neighbourColm), cost, neighbour});
+                    std::push_heap(localOpenSet_.begin(), localOpenSet_.end(), isCheaper);
+                }
+            }
+        }
+    }
+
+    std::size_t HPAStar::getCluster(int row, int colm) const {
+        return static_cast<std::size_t>(row / clusterSize_) * clusterColms_ + static_cast<std::size_t>(colm / clusterSize_);
+    }
+
+    std::size_t HPAStar::getLocalIndex(int row, int colm) const {
+        return static_cast<std::size_t>(row % clusterSize_) * clusterSize_ + static_cast<std::size_t>(colm % clusterSize_);
+    }
+
+    bool HPAStar::isAccessible(int row, int colm) const {
+        return row >= 0 && row < rows_ && colm >= 0 && colm < colms_
+            && accessible_[static_cast<std::size_t>(row) * colms_ + colm];
+    }
+
+    std::size_t HPAStar::getEntranceCount() const {
+        return nodeTiles_.size();
+    }
+
+    std::size_t HPAStar::getExpandedCount() const {
+        return expandedCount_;
+    }
+
+    std::string HPAStar::getType() const {
+        return "HPAStar";
+    }
+
+    std::string HPAStar::getSettings() const {
+        return std::to_string(clusterSize_);
+    }
+}
@@ -43,5 +43,9 @@ namespace mighter2d {
 
         return path;
     }
+
+    std::string IPathFinderStrategy::getSettings() const {
+        return "";
+    }
 }
 
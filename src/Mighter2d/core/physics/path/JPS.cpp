@@ -0,0 +1,332 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/physics/path/JPS.h"
+#include "Mighter2d/core/physics/path/PathCosts.h"
+#include "Mighter2d/core/grid/Grid.h"
+#include <algorithm>
+
+namespace mighter2d {
+    namespace {
+        // Inverted for a min-heap, ties are broken in favour of the node closer to the target
+        constexpr auto isBetter = [](const auto& lhs, const auto& rhs) {
+            return lhs.fScore > rhs.fScore || (lhs.fScore == rhs.fScore && lhs.gScore < rhs.gScore);
+        };
+
+        int sign(int value) {
+            return (value > 0) - (value < 0);
+        }
+    }
+
+    JPS::JPS(const Vector2u& gridSize, GridMover::MoveRestriction moveRestriction) :
+        moveRestriction_{GridMover::MoveRestriction::NonDiagonal},
+        grid_{nullptr},
+        colms_{0},
+        searchId_{0},
+        expandedCount_{0}
+    {
+        setMoveRestriction(moveRestriction);
+        resize(static_cast<std::size_t>(gridSize.x) * gridSize.y);
+    }
+
+    void JPS::setMoveRestriction(GridMover::MoveRestriction moveRestriction) {
+        MIGHTER2D_ASSERT(moveRestriction == GridMover::MoveRestriction::None || moveRestriction == GridMover::MoveRestriction::NonDiagonal,
+            "JPS only supports the MoveRestriction::None and MoveRestriction::NonDiagonal move restrictions")
+        moveRestriction_ = moveRestriction;
+    }
+
+    GridMover::MoveRestriction JPS::getMoveRestriction() const {
+        return moveRestriction_;
+    }
+
+    std::stack<Index> JPS::findPath(const Grid &grid, const Index &sourceTile, const Index &targetTile) {
+        expandedCount_ = 0;
+
+        if (sourceTile == targetTile || !grid.isReachable(sourceTile, targetTile))
+            return std::stack<Index>{};
+
+        grid_ = &grid;
+        target_ = targetTile;
+        colms_ = static_cast<std::size_t>(grid.getSizeInTiles().x);
+        resize(colms_ * grid.getSizeInTiles().y);
+
+        // Tiles whose stamp is not the current search id are unvisited
+        if (++searchId_ == 0) {
+            std::fill(openedIn_.begin(), openedIn_.end(), 0u);
+            std::fill(closedIn_.begin(), closedIn_.end(), 0u);
+            std::fill(checkedIn_.begin(), checkedIn_.end(), 0u);
+            searchId_ = 1;
+        }
+
+        std::stack<Index> path;
+        if (!isWalkable(targetTile.row, targetTile.colm)) {
+            grid_ = nullptr;
+            return path;
+        }
+
+        const std::size_t source = static_cast<std::size_t>(sourceTile.row) * colms_ + static_cast<std::size_t>(sourceTile.colm);
+        const std::size_t target = static_cast<std::size_t>(targetTile.row) * colms_ + static_cast<std::size_t>(targetTile.colm);
+
+        openSet_.clear();
+        gScores_[source] = 0.0f;
+        parents_[source] = source;
+        openedIn_[source] = searchId_;
+        openSet_.push_back({estimate(sourceTile.row, sourceTile.colm), 0.0f, source});
+
+        while (!openSet_.empty()) {
+            std::pop_heap(openSet_.begin(), openSet_.end(), isBetter);
+            OpenNode node = openSet_.back();
+            openSet_.pop_back();
+
+            // A tile is pushed again when a cheaper path to it is found, skip the outdated entries
+            if (closedIn_[node.tile] == searchId_ || node.gScore > gScores_[node.tile])
+                continue;
+
+            closedIn_[node.tile] = searchId_;
+            expandedCount_++;
+
+            if (node.tile == target) {
+                // Fill in the tiles between consecutive jump points
+                for (auto tile = target; tile != source; tile = parents_[tile]) {
+                    Index current{static_cast<int>(tile / colms_), static_cast<int>(tile % colms_)};
+                    const Index parent{static_cast<int>(parents_[tile] / colms_), static_cast<int>(parents_[tile] % colms_)};
+                    const int rowStep = sign(parent.row - current.row);
+                    const int colmStep = sign(parent.colm - current.colm);
+
+                    while (current != parent) {
+                        path.push(current);
+                        current.row += rowStep;
+                        current.colm += colmStep;
+                    }
+                }
+
+                break;
+            }
+
+            addSuccessors(node, static_cast<int>(node.tile / colms_), static_cast<int>(node.tile % colms_));
+        }
+
+        grid_ = nullptr;
+        return path;
+    }
+
+    void JPS::addSuccessors(const OpenNode& node, int row, int colm) {
+        const bool isDiagonalAllowed = moveRestriction_ == GridMover::MoveRestriction::None;
+        const std::size_t parent = parents_[node.tile];
+        const int rowDir = sign(static_cast<int>(node.tile / colms_) - static_cast<int>(parent / colms_));
+        const int colmDir = sign(static_cast<int>(node.tile % colms_) - static_cast<int>(parent % colms_));
+
+        // The directions in which the path may continue (at most 8)
+        int directions[8][2];
+        int directionCount = 0;
+        auto addDirection = [&directions, &directionCount](int dRow, int dColm) {
+            directions[directionCount][0] = dRow;
+            directions[directionCount][1] = dColm;
+            directionCount++;
+        };
+
+        if (rowDir == 0 && colmDir == 0) { // Source tile, all the directions are open
+            addDirection(0, -1);
+            addDirection(-1, 0);
+            addDirection(0, 1);
+            addDirection(1, 0);
+
+            if (isDiagonalAllowed) {
+                for (int dRow : {-1, 1}) {
+                    for (int dColm : {-1, 1}) {
+                        if (isWalkable(row + dRow, colm) && isWalkable(row, colm + dColm))
+                            addDirection(dRow, dColm);
+                    }
+                }
+            }
+        } else if (!isDiagonalAllowed) {
+            // Continue straight ahead or turn to either side
+            addDirection(rowDir, colmDir);
+            addDirection(colmDir, rowDir);
+            addDirection(-colmDir, -rowDir);
+        } else if (rowDir != 0 && colmDir != 0) {
+            const bool isVerticalWalkable = isWalkable(row + rowDir, colm);
+            const bool isHorizontalWalkable = isWalkable(row, colm + colmDir);
+
+            if (isVerticalWalkable)
+                addDirection(rowDir, 0);
+
+            if (isHorizontalWalkable)
+                addDirection(0, colmDir);
+
+            if (isVerticalWalkable && isHorizontalWalkable)
+                addDirection(rowDir, colmDir);
+        } else {
+            // The two sides of a straight move
+            const int sideRow = colmDir;
+            const int sideColm = rowDir;
+            const bool isNextWalkable = isWalkable(row + rowDir, colm + colmDir);
+            const bool isLeftWalkable = isWalkable(row + sideRow, colm + sideColm);
+            const bool isRightWalkable = isWalkable(row - sideRow, colm - sideColm);
+
+            if (isNextWalkable) {
+                addDirection(rowDir, colmDir);
+
+                if (isLeftWalkable)
+                    addDirection(rowDir + sideRow, colmDir + sideColm);
+
+                if (isRightWalkable)
+                    addDirection(rowDir - sideRow, colmDir - sideColm);
+            }
+
+            if (isLeftWalkable)
+                addDirection(sideRow, sideColm);
+
+            if (isRightWalkable)
+                addDirection(-sideRow, -sideColm);
+        }
+
+        for (int i = 0; i < directionCount; ++i) {
+            Index jumpPoint;
+            if (!jump(row + directions[i][0], colm + directions[i][1], directions[i][0], directions[i][1], jumpPoint))
+                continue;
+
+            const std::size_t tile = static_cast<std::size_t>(jumpPoint.row) * colms_ + static_cast<std::size_t>(jumpPoint.colm);
+            if (closedIn_[tile] == searchId_)
+                continue;
+
+            // Jump points are reached along a single straight or diagonal line
+            const float gScore = node.gScore + priv::getDistanceCost(jumpPoint.row - row, jumpPoint.colm - colm, true);
+
+            if (openedIn_[tile] != searchId_ || gScore < gScores_[tile]) {
+                openedIn_[tile] = searchId_;
+                gScores_[tile] = gScore;
+                parents_[tile] = node.tile;
+                openSet_.push_back({gScore + estimate(jumpPoint.row, jumpPoint.colm), gScore, tile});
+                std::push_heap(openSet_.begin(), openSet_.end(), isBetter);
+            }
+        }
+    }
+
+    bool JPS::jump(int row, int colm, int rowDir, int colmDir, Index& jumpPoint) {
+        if (rowDir == 0 || colmDir == 0)
+            return jumpStraight(row, colm, rowDir, colmDir, jumpPoint);
+
+        Index straightJumpPoint;
+        while (isWalkable(row, colm)) {
+            if (row == target_.row && colm == target_.colm) {
+                jumpPoint = {row, colm};
+                return true;
+            }
+
+            // A tile from which a straight line leads to a jump point is a jump point
+            if (jumpStraight(row, colm + colmDir, 0, colmDir, straightJumpPoint)
+                || jumpStraight(row + rowDir, colm, rowDir, 0, straightJumpPoint))
+            {
+                jumpPoint = {row, colm};
+                return true;
+            }
+
+            // Corners cannot be cut
+            if (!isWalkable(row + rowDir, colm) || !isWalkable(row, colm + colmDir))
+                return false;
+
+            row += rowDir;
+            colm += colmDir;
+        }
+
+        return false;
+    }
+
+    bool JPS::jumpStraight(int row, int colm, int rowDir, int colmDir, Index& jumpPoint) {
+        const bool isDiagonalAllowed = moveRestriction_ == GridMover::MoveRestriction::None;
+        const int sideRow = colmDir;
+        const int sideColm = rowDir;
+
+        Index sideJumpPoint;
+        while (isWalkable(row, colm)) {
+            if (row == target_.row && colm == target_.colm) {
+                jumpPoint = {row, colm};
+                return true;
+            }
+
+            // A tile is a jump point if it has a side that can only be reached optimally through it
+            if ((isWalkable(row + sideRow, colm + sideColm) && !isWalkable(row + sideRow - rowDir, colm + sideColm - colmDir))
+                || (isWalkable(row - sideRow, colm - sideColm) && !isWalkable(row - sideRow - rowDir, colm - sideColm - colmDir)))
+            {
+                jumpPoint = {row, colm};
+                return true;
+            }
+
+            // Without diagonal moves, a vertical line turns at the tiles from which a horizontal line leads to a jump point
+            if (!isDiagonalAllowed && rowDir != 0
+                && (jumpStraight(row, colm - 1, 0, -1, sideJumpPoint) || jumpStraight(row, colm + 1, 0, 1, sideJumpPoint)))
+            {
+                jumpPoint = {row, colm};
+                return true;
+            }
+
+            row += rowDir;
+            colm += colmDir;
+        }
+
+        return false;
+    }
+
+    bool JPS::isWalkable(int row, int colm) {
+        if (row < 0 || colm < 0 || !grid_->isIndexValid(Index{row, colm}))
+            return false;
+
+        const std::size_t tile = static_cast<std::size_t>(row) * colms_ + static_cast<std::size_t>(colm);
+        if (checkedIn_[tile] != searchId_) {
+            checkedIn_[tile] = searchId_;
+            walkable_[tile] = grid_->isTileAccessible(Index{row, colm});
+        }
+
+        return walkable_[tile];
+    }
+
+    float JPS::estimate(int row, int colm) const {
+        return priv::getDistanceCost(row - target_.row, colm - target_.colm, moveRestriction_ == GridMover::MoveRestriction::None);
+    }
+
+    void JPS::resize(std::size_t tileCount) {
+        if (gScores_.size() >= tileCount)
+            return;
+
+        gScores_.resize(tileCount);
+        parents_.resize(tileCount);
+        openedIn_.resize(tileCount, 0u);
+        closedIn_.resize(tileCount, 0u);
+        checkedIn_.resize(tileCount, 0u);
+        walkable_.resize(tileCount, false);
+    }
+
+    std::size_t JPS::getExpandedCount() const {
+        return expandedCount_;
+    }
+
+    std::string JPS::getType() const {
+        return "JPS";
+    }
+
+    std::string JPS::getSettings() const {
+        return moveRestriction_ == GridMover::MoveRestriction::None ? "None" : "NonDiagonal";
+    }
+}
@@ -0,0 +1,190 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/physics/path/PathCache.h"
+#include "Mighter2d/core/grid/Grid.h"
+#include <algorithm>
+
+namespace mighter2d {
+    bool PathCache::Key::operator==(const Key &other) const {
+        return source == other.source && target == other.target
+            && restriction == other.restriction && pathFinderType == other.pathFinderType
+            && pathFinderSettings == other.pathFinderSettings;
+    }
+
+    std::size_t PathCache::KeyHash::operator()(const Key &key) const {
+        auto hash = std::hash<std::string>()(key.pathFinderType) * 31 + std::hash<std::string>()(key.pathFinderSettings);
+        for (int value : {key.source.row, key.source.colm, key.target.row, key.target.colm, static_cast<int>(key.restriction)})
+            hash = hash * 31 + std::hash<int>()(value);
+
+        return hash;
+    }
+
+    PathCache::PathCache(std::size_t capacity) :
+        capacity_{capacity},
+        gridId_{0},
+        version_{0},
+        hitCount_{0},
+        missCount_{0}
+    {
+        MIGHTER2D_ASSERT(capacity > 0, "The capacity of a path cache must be greater than zero")
+    }
+
+    const std::stack<Index>* PathCache::find(const Grid &grid, const Key &key) {
+        validate(grid);
+
+        auto entry = lookup_.find(key);
+        if (entry == lookup_.end()) {
+            missCount_++;
+            return nullptr;
+        }
+
+        hitCount_++;
+        entries_.splice(entries_.begin(), entries_, entry->second);
+        return &entry->second->path;
+    }
+
+    void PathCache::insert(const Grid &grid, const Key &key, const std::stack<Index> &path) {
+        validate(grid);
+
+        auto entry = lookup_.find(key);
+        if (entry != lookup_.end()) {
+            *entry->second = makeEntry(key, path);
+            entries_.splice(entries_.begin(), entries_, entry->second);
+            return;
+        }
+
+        // Reuse the least recently used entry instead of allocating a new one
+        if (entries_.size() == capacity_) {
+            lookup_.erase(entries_.back().key);
+            entries_.splice(entries_.begin(), entries_, std::prev(entries_.end()));
+            entries_.front() = makeEntry(key, path);
+        } else
+            entries_.push_front(makeEntry(key, path));
+
+        lookup_.emplace(key, entries_.begin());
+    }
+
+    void PathCache::setCapacity(std::size_t capacity) {
+        MIGHTER2D_ASSERT(capacity > 0, "The capacity of a path cache must be greater than zero")
+
+        capacity_ = capacity;
+        while (entries_.size() > capacity_) {
+            lookup_.erase(entries_.back().key);
+            entries_.pop_back();
+        }
+    }
+
+    std::size_t PathCache::getCapacity() const {
+        return capacity_;
+    }
+
+    std::size_t PathCache::getSize() const {
+        return entries_.size();
+    }
+
+    std::size_t PathCache::getHitCount() const {
+        return hitCount_;
+    }
+
+    std::size_t PathCache::getMissCount() const {
+        return missCount_;
+    }
+
+    void PathCache::clear() {
+        entries_.clear();
+        lookup_.clear();
+    }
+
+    void PathCache::validate(const Grid &grid) {
+        if (grid.getObjectId() == gridId_ && grid.getVersion() == version_)
+            return;
+
+        if (grid.getObjectId() != gridId_ || !grid.getChangedTiles(version_, changedTiles_))
+            clear();
+        else {
+            changedTileSet_.clear();
+            changedTileSet_.insert(changedTiles_.begin(), changedTiles_.end());
+
+            // A tile that was freed or became cheaper may shorten the paths around it
+            enterableTiles_.clear();
+            for (const auto& tile : changedTiles_) {
+                if (grid.isTileAccessible(tile))
+                    enterableTiles_.push_back(tile);
+            }
+
+            for (auto entry = entries_.begin(); entry != entries_.end();) {
+                if (isOutdated(grid, *entry)) {
+                    lookup_.erase(entry->key);
+                    entry = entries_.erase(entry);
+                } else
+                    ++entry;
+            }
+        }
+
+        gridId_ = grid.getObjectId();
+        version_ = grid.getVersion();
+    }
+
+    bool PathCache::isOutdated(const Grid &grid, const Entry &entry) const {
+        if (entry.tiles.empty())
+            return grid.isReachable(entry.key.source, entry.key.target);
+
+        bool isPathChanged = std::any_of(entry.tiles.begin(), entry.tiles.end(), [this](const Index& tile) {
+            return changedTileSet_.count(tile) > 0;
+        });
+
+        return isPathChanged || std::any_of(enterableTiles_.begin(), enterableTiles_.end(), [&entry](const Index& tile) {
+            return tile.row >= entry.topLeft.row && tile.row <= entry.bottomRight.row
+                && tile.colm >= entry.topLeft.colm && tile.colm <= entry.bottomRight.colm;
+        });
+    }
+
+    PathCache::Entry PathCache::makeEntry(const Key &key, const std::stack<Index> &path) {
+        Entry entry{key, path, {}, key.source, key.source};
+        entry.tiles.reserve(path.size());
+
+        Index previous = key.source;
+        for (auto tiles = path; !tiles.empty(); tiles.pop()) {
+            const Index tile = tiles.top();
+
+            // A diagonal move is only allowed while both tiles beside it can be entered
+            if (tile.row != previous.row && tile.colm != previous.colm) {
+                entry.tiles.push_back(Index{previous.row, tile.colm});
+                entry.tiles.push_back(Index{tile.row, previous.colm});
+            }
+
+            entry.tiles.push_back(tile);
+            entry.topLeft = Index{std::min(entry.topLeft.row, tile.row), std::min(entry.topLeft.colm, tile.colm)};
+            entry.bottomRight = Index{std::max(entry.bottomRight.row, tile.row), std::max(entry.bottomRight.colm, tile.colm)};
+            previous = tile;
+        }
+
+        // A freed tile just outside the path can also shorten it
+        entry.topLeft = Index{entry.topLeft.row - 1, entry.topLeft.colm - 1};
+        entry.bottomRight = Index{entry.bottomRight.row + 1, entry.bottomRight.colm + 1};
+
+        return entry;
+    }
+}
@@ -0,0 +1,55 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_PATHCOSTS_H
+#define MIGHTER2D_PATHCOSTS_H
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace mighter2d::priv {
+    /**
+     * @brief The cost of a diagonal move relative to a horizontal or vertical move
+     */
+    constexpr float DIAGONAL_COST = 1.41421356f;
+
+    /**
+     * @brief Get the cost between two tiles when no tile is in the way
+     * @param rowDistance The number of rows between the tiles
+     * @param colmDistance The number of columns between the tiles
+     * @param isDiagonalAllowed True if diagonal moves are allowed, otherwise false
+     * @return The Octile distance if diagonal moves are allowed, otherwise the Manhattan distance
+     */
+    inline float getDistanceCost(int rowDistance, int colmDistance, bool isDiagonalAllowed) {
+        auto rows = static_cast<float>(std::abs(rowDistance));
+        auto colms = static_cast<float>(std::abs(colmDistance));
+
+        if (isDiagonalAllowed)
+            return std::max(rows, colms) + (DIAGONAL_COST - 1.0f) * std::min(rows, colms);
+
+        return rows + colms;
+    }
+}
+
+#endif // MIGHTER2D_PATHCOSTS_H
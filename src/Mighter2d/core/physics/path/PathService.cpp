@@ -0,0 +1,291 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/physics/path/PathService.h"
+#include "Mighter2d/core/physics/path/AStarSearch.h"
+#include "Mighter2d/core/grid/Grid.h"
+#include <algorithm>
+
+namespace mighter2d {
+    struct PathService::SearchState {
+        Snapshot snapshot;        //!< The copy of the grid the requests are solved on
+        Uint64 sequence = 0;      //!< The last delta applied to the copy, zero if none
+        priv::AStarSearch search; //!< Finds the paths
+    };
+
+    Vector2u PathService::Snapshot::getSizeInTiles() const {
+        return {colms, rows};
+    }
+
+    bool PathService::Snapshot::isIndexValid(const Index &index) const {
+        return index.row >= 0 && index.row < static_cast<int>(rows) && index.colm >= 0 && index.colm < static_cast<int>(colms);
+    }
+
+    bool PathService::Snapshot::isTileAccessible(const Index &index) const {
+        return isIndexValid(index) && accessible[static_cast<std::size_t>(index.row) * colms + static_cast<std::size_t>(index.colm)];
+    }
+
+    float PathService::Snapshot::getMovementCost(const Index &index) const {
+        return costs[static_cast<std::size_t>(index.row) * colms + static_cast<std::size_t>(index.colm)];
+    }
+
+    void PathService::Snapshot::setTile(const TileState &state) {
+        accessible[state.tile] = state.isAccessible;
+        costs[state.tile] = state.cost;
+    }
+
+    PathService::PathService(Grid& grid, unsigned int threadCount, AStar::Heuristic heuristic) :
+        IUpdatable(grid.getScene()),
+        grid_{&grid},
+        heuristic_{heuristic},
+        maxResultsPerFrame_{32},
+        requestCounter_{0},
+        gridVersion_{0},
+        deltaCounter_{0},
+        changesSinceCopy_{0},
+        isStopping_{false}
+    {
+        MIGHTER2D_ASSERT(threadCount > 0, "A path service needs at least one worker thread")
+
+        gridDestructionId_ = grid_->onDestruction([this] {
+            grid_ = nullptr;
+        });
+
+        for (unsigned int i = 0; i < threadCount; i++)
+            workers_.emplace_back(&PathService::workerLoop, this);
+    }
+
+    PathService::Ptr PathService::create(Grid &grid, unsigned int threadCount, AStar::Heuristic heuristic) {
+        return std::make_unique<PathService>(grid, threadCount, heuristic);
+    }
+
+    std::string PathService::getClassName() const {
+        return "PathService";
+    }
+
+    unsigned int PathService::getThreadCount() const {
+        return static_cast<unsigned int>(workers_.size());
+    }
+
+    int PathService::requestPath(const Index &sourceTile, const Index &targetTile,
+        const Callback<const std::stack<Index>&>& callback)
+    {
+        MIGHTER2D_ASSERT(grid_, "Cannot request a path after the grid is destroyed")
+        MIGHTER2D_ASSERT(!grid_->isStreamed(), "A path service cannot be used with a streamed grid")
+        MIGHTER2D_ASSERT(callback, "The callback of a path request must not be a nullptr")
+
+        int id = requestCounter_++;
+        callbacks_.emplace(id, callback);
+
+        // Unreachable targets are rejected without a search, the empty path is still delivered on a later frame
+        if (sourceTile == targetTile || !grid_->isReachable(sourceTile, targetTile)) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            results_.push_back(Result{id, std::stack<Index>{}});
+            return id;
+        }
+
+        recordChanges();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            requests_.push_back(Request{id, sourceTile, targetTile, deltaCounter_});
+        }
+
+        requestReady_.notify_one();
+        return id;
+    }
+
+    bool PathService::cancelRequest(int id) {
+        if (callbacks_.erase(id) == 0)
+            return false;
+
+        // Save the workers the trouble if the request is still queued
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto request = std::find_if(requests_.begin(), requests_.end(), [id](const Request& request) {
+            return request.id == id;
+        });
+
+        if (request != requests_.end())
+            requests_.erase(request);
+
+        return true;
+    }
+
+    std::size_t PathService::getPendingCount() const {
+        return callbacks_.size();
+    }
+
+    void PathService::setMaxResultsPerFrame(unsigned int maxResults) {
+        MIGHTER2D_ASSERT(maxResults > 0, "The maximum number of results delivered per frame must be greater than zero")
+        maxResultsPerFrame_ = maxResults;
+    }
+
+    unsigned int PathService::getMaxResultsPerFrame() const {
+        return maxResultsPerFrame_;
+    }
+
+    void PathService::update(Time deltaTime) {
+        MIGHTER2D_UNUSED(deltaTime);
+
+        std::vector<std::pair<Callback<const std::stack<Index>&>, std::stack<Index>>> deliveries;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            while (!results_.empty() && deliveries.size() < maxResultsPerFrame_) {
+                Result result = std::move(results_.front());
+                results_.pop_front();
+
+                // Results of cancelled requests do not count towards the limit
+                auto callback = callbacks_.find(result.id);
+                if (callback != callbacks_.end()) {
+                    deliveries.emplace_back(std::move(callback->second), std::move(result.path));
+                    callbacks_.erase(callback);
+                }
+            }
+        }
+
+        // The callbacks are executed without the lock since they may request new paths
+        for (auto& [callback, path] : deliveries)
+            callback(path);
+    }
+
+    void PathService::recordChanges() {
+        const Uint64 version = grid_->getVersion();
+        const Vector2u size = grid_->getSizeInTiles();
+        if (deltaCounter_ > 0 && gridVersion_ == version && gridSize_ == size)
+            return;
+
+        const std::size_t tileCount = static_cast<std::size_t>(size.x) * size.y;
+        const bool canRecordChanges = deltaCounter_ > 0 && gridSize_ == size
+            && grid_->getChangedTiles(gridVersion_, changedTiles_)
+            && changesSinceCopy_ + changedTiles_.size() < tileCount;
+
+        gridVersion_ = version;
+        gridSize_ = size;
+
+        auto delta = std::make_shared<Delta>();
+        delta->sequence = ++deltaCounter_;
+
+        if (canRecordChanges) {
+            delta->changes.reserve(changedTiles_.size());
+            for (const auto& index : changedTiles_)
+                delta->changes.push_back(getTileState(index));
+
+            changesSinceCopy_ += changedTiles_.size();
+        } else {
+            auto snapshot = std::make_shared<Snapshot>();
+            snapshot->rows = size.y;
+            snapshot->colms = size.x;
+            snapshot->accessible.resize(tileCount);
+            snapshot->costs.resize(tileCount);
+
+            for (unsigned int row = 0; row < size.y; row++) {
+                for (unsigned int colm = 0; colm < size.x; colm++)
+                    snapshot->setTile(getTileState(Index{static_cast<int>(row), static_cast<int>(colm)}));
+            }
+
+            delta->snapshot = std::move(snapshot);
+            changesSinceCopy_ = 0;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        deltas_.push_back(std::move(delta));
+
+        // A worker that is behind a copy starts over from it, so the deltas before the
+        // last copy that is not newer than any of the queued requests are no longer needed
+        const Uint64 oldestSequence = requests_.empty() ? deltaCounter_ : requests_.front().sequence;
+        auto copy = std::find_if(deltas_.rbegin(), deltas_.rend(), [oldestSequence](const auto& delta) {
+            return delta->snapshot && delta->sequence <= oldestSequence;
+        });
+
+        deltas_.erase(deltas_.begin(), copy.base() - 1);
+    }
+
+    PathService::TileState PathService::getTileState(const Index &index) const {
+        const std::size_t tile = static_cast<std::size_t>(index.row) * gridSize_.x + static_cast<std::size_t>(index.colm);
+        return TileState{tile, grid_->isTileAccessible(index), grid_->getMovementCost(index)};
+    }
+
+    void PathService::workerLoop() {
+        SearchState state;
+        std::vector<std::shared_ptr<const Delta>> deltas;
+
+        while (true) {
+            Request request;
+
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                requestReady_.wait(lock, [this] { return isStopping_ || !requests_.empty(); });
+
+                if (isStopping_)
+                    return;
+
+                request = std::move(requests_.front());
+                requests_.pop_front();
+
+                // The deltas are consecutive and start with a copy of the grid that is not newer than the request
+                const Uint64 first = deltas_.front()->sequence;
+                for (Uint64 sequence = std::max(state.sequence + 1, first); sequence <= request.sequence; sequence++)
+                    deltas.push_back(deltas_[static_cast<std::size_t>(sequence - first)]);
+            }
+
+            for (const auto& delta : deltas) {
+                if (delta->snapshot)
+                    state.snapshot = *delta->snapshot;
+                else {
+                    for (const auto& change : delta->changes)
+                        state.snapshot.setTile(change);
+                }
+
+                state.sequence = delta->sequence;
+            }
+
+            deltas.clear();
+            std::stack<Index> path = state.search.findPath(state.snapshot, request.source, request.target,
+                heuristic_ == AStar::Heuristic::Octile);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                results_.push_back(Result{request.id, std::move(path)});
+            }
+        }
+    }
+
+    PathService::~PathService() {
+        emitDestruction();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            isStopping_ = true;
+        }
+
+        requestReady_.notify_all();
+
+        for (auto& worker : workers_)
+            worker.join();
+
+        if (grid_)
+            grid_->removeDestructionListener(gridDestructionId_);
+    }
+}
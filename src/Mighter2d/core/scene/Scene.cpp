@@ -28,6 +28,7 @@
 #include "Mighter2d/utility/Helpers.h"
 #include "Mighter2d/graphics/RenderTarget.h"
 #include "Mighter2d/core/scene/BackgroundScene.h"
+#include "Mighter2d/core/physics/CollisionManager.h"
 #include <utility>
 
 namespace mighter2d {
@@ -40,7 +41,8 @@ namespace mighter2d {
         isActive_{false},
         isPaused_{false},
         isVisibleWhenPaused_{false},
-        cacheState_{false, ""}
+        cacheState_{false, ""},
+        collisionManager_{std::make_unique<priv::CollisionManager>()}
     {
         renderLayers_.create("default");
     }
@@ -66,6 +68,13 @@ namespace mighter2d {
             isActive_ = other.isActive_;
             isPaused_ = other.isPaused_;
             backgroundScene_ = std::move(other.backgroundScene_);
+            collisionManager_ = std::move(other.collisionManager_);
+            other.collisionManager_ = std::make_unique<priv::CollisionManager>();
+
+            // The destruction listeners of the collidables were moved along with the other scenes listeners
+            collisionManager_->forEachCollidable([this](Collidable& collidable) {
+                collidable.setScene(*this);
+            });
             sceneStateObserver_ = std::move(sceneStateObserver_);
         }
 
@@ -100,13 +109,15 @@ namespace mighter2d {
     }
 
     void Scene::addCollidable(Collidable *collidable) {
-        if (!utility::findIn(collidableList_, collidable).first) {
-            collidableList_.push_back(collidable);
-        }
+        collisionManager_->addCollidable(collidable);
     }
 
     bool Scene::removeCollidable(Collidable *collidable) {
-        return utility::eraseIn(collidableList_, collidable);
+        return collisionManager_->removeCollidable(collidable);
+    }
+
+    void Scene::updateCollidable(Collidable *collidable) {
+        collisionManager_->updateCollidable(collidable);
     }
 
     void Scene::addSystemEventHandler(ISystemEventHandler *sysEventHandler) {
@@ -211,6 +222,40 @@ namespace mighter2d {
         return timescale_;
     }
 
+    void Scene::setCollisionCellSize(float size) {
+        if (size <= 0.0f)
+            throw InvalidArgumentException("'mighter2d::Scene::setCollisionCellSize()' - The cell size must be greater than zero");
+
+        collisionManager_->setCellSize(size);
+    }
+
+    float Scene::getCollisionCellSize() const {
+        return collisionManager_->getCellSize();
+    }
+
+    void Scene::setCollisionThreadCount(unsigned int count) {
+        if (count == 0)
+            throw InvalidArgumentException("'mighter2d::Scene::setCollisionThreadCount()' - The thread count must be greater than zero");
+
+        collisionManager_->setThreadCount(count);
+    }
+
+    unsigned int Scene::getCollisionThreadCount() const {
+        return collisionManager_->getThreadCount();
+    }
+
+    void Scene::queryAABB(const FloatRect &rect, const Callback<Collidable&> &callback) {
+        collisionManager_->queryAABB(rect, callback);
+    }
+
+    void Scene::queryPoint(const Vector2f &point, const Callback<Collidable&> &callback) {
+        collisionManager_->queryPoint(point, callback);
+    }
+
+    void Scene::raycast(const Vector2f &from, const Vector2f &to, const Callback<Collidable&, float> &callback) {
+        collisionManager_->raycast(from, to, callback);
+    }
+
     Engine &Scene::getEngine() {
         return const_cast<Engine&>(std::as_const(*this).getEngine());
     }
@@ -359,11 +404,7 @@ namespace mighter2d {
             if (backgroundScene_)
                 backgroundScene_->postUpdate();
 
-            for (int i = 0; i < collidableList_.size(); i++) {
-                for (int j = i + 1; j < collidableList_.size(); j++) {
-                    collidableList_[i]->handleCollidable(*collidableList_[j]);
-                }
-            }
+            collisionManager_->update();
         }
     }
 
@@ -98,8 +98,8 @@ namespace mighter2d::priv {
         window_.close();
     }
 
-    void RenderTarget::draw(const sf::Drawable &drawable) {
-        window_.draw(drawable);
+    void RenderTarget::draw(const sf::Drawable &drawable, const sf::RenderStates& states) {
+        window_.draw(drawable, states);
     }
 
     void RenderTarget::draw(const Drawable &drawable) {
@@ -143,8 +143,9 @@ namespace mighter2d::priv {
         /**
          * @brief Draw drawable on the window
          * @param drawable Object to be drawn
+         * @param states The render states to draw the object with
          */
-        void draw(const sf::Drawable &drawable);
+        void draw(const sf::Drawable &drawable, const sf::RenderStates& states = sf::RenderStates::Default);
 
         /**
          * @brief Draw drawable on the window
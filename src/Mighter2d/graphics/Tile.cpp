@@ -31,7 +31,8 @@ namespace mighter2d {
         id_{'\0'},
         index_{-1, -1},
         tile_(scene, {static_cast<float>(size.x), static_cast<float>(size.y)}),
-        isCollidable_{false}
+        isCollidable_{false},
+        gridPosition_{nullptr}
     {
         tile_.setFillColour(Colour::White);
         tile_.setPosition(position);
@@ -42,10 +43,15 @@ namespace mighter2d {
         id_{other.id_},
         index_{other.index_},
         tile_{other.tile_},
-        isCollidable_{other.isCollidable_}
-    {}
+        isCollidable_{other.isCollidable_},
+        gridPosition_{nullptr}
+    {
+        // A copy may outlive the grid, so it does not follow the grid position
+        tile_.setPosition(other.getPosition());
+    }
 
     Tile& Tile::operator=(Tile other) {
+        // The copy constructor already resolved the position of other
         swap(other);
         return *this;
     }
@@ -57,6 +63,8 @@ namespace mighter2d {
         swap(index_, other.index_);
         swap(tile_, other.tile_);
         swap(isCollidable_, other.isCollidable_);
+        swap(gridPosition_, other.gridPosition_);
+        swap(gridOffset_, other.gridOffset_);
     }
 
     std::string Tile::getClassName() const {
@@ -72,7 +80,10 @@ namespace mighter2d {
         if (getPosition() == Vector2f{x, y})
             return;
 
-        tile_.setPosition(x, y);
+        if (gridPosition_)
+            gridOffset_ = Vector2f{x, y} - *gridPosition_;
+        else
+            tile_.setPosition(x, y);
 
         emitChange(Property{Property{"position", getPosition()}});
     }
@@ -82,12 +93,21 @@ namespace mighter2d {
     }
 
     Vector2f Tile::getPosition() const {
+        if (gridPosition_)
+            return *gridPosition_ + gridOffset_;
+
         return {tile_.getPosition().x, tile_.getPosition().y};
     }
 
+    void Tile::setGridPosition(const Vector2f* gridPosition, Vector2f offset) {
+        gridPosition_ = gridPosition;
+        gridOffset_ = offset;
+    }
+
     Vector2f Tile::getWorldCentre() const {
-        return {tile_.getPosition().x + tile_.getSize().x / 2.0f,
-                tile_.getPosition().y + tile_.getSize().y / 2.0f};
+        Vector2f position = getPosition();
+        return {position.x + tile_.getSize().x / 2.0f,
+                position.y + tile_.getSize().y / 2.0f};
     }
 
     Vector2f Tile::getLocalCentre() const {
@@ -0,0 +1,458 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/graphics/TileMap.h"
+#include "Mighter2d/core/exceptions/Exceptions.h"
+#include "Mighter2d/core/resources/ResourceManager.h"
+#include "Mighter2d/graphics/TileMapLayer.h"
+#include "Mighter2d/utility/DiskFileReader.h"
+#include "Mighter2d/utility/XmlParser.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+
+namespace mighter2d {
+    namespace {
+        // Tiled stores the flip flags of a tile in the highest bits of its global id
+        constexpr unsigned long TMX_FLIP_FLAGS = 0xF0000000ul;
+
+        /**
+         * @brief Parse an integer
+         * @param text The text to be parsed, may be surrounded by whitespace
+         * @param value The parsed value
+         * @return True if @a text is an integer, otherwise false
+         */
+        bool parseInt(const std::string& text, long long& value) {
+            auto start = text.find_first_not_of(" \t\r\n");
+            if (start == std::string::npos)
+                return false;
+
+            char* end = nullptr;
+            errno = 0;
+            value = std::strtoll(text.c_str() + start, &end, 10);
+
+            if (errno != 0 || end == text.c_str() + start)
+                return false;
+
+            return text.find_first_not_of(" \t\r\n", static_cast<std::size_t>(end - text.c_str())) == std::string::npos;
+        }
+
+        /**
+         * @brief Parse comma separated rows of integers
+         * @param text The rows to be parsed, one row per line
+         * @param errorPrefix The beginning of the message of a thrown exception
+         * @return The parsed rows, empty lines are skipped
+         * @throws InvalidParseException If a value is not an integer
+         *
+         * A trailing comma at the end of a row is ignored
+         */
+        std::vector<std::vector<long long>> parseCSV(const std::string& text, const std::string& errorPrefix) {
+            std::vector<std::vector<long long>> rows;
+            std::size_t lineStart = 0;
+
+            while (lineStart < text.size()) {
+                auto lineEnd = std::min(text.find('\n', lineStart), text.size());
+                std::string line = text.substr(lineStart, lineEnd - lineStart);
+                lineStart = lineEnd + 1;
+
+                if (line.find_first_not_of(" \t\r") == std::string::npos)
+                    continue;
+
+                std::vector<long long> row;
+                std::size_t valueStart = 0;
+                while (valueStart <= line.size()) {
+                    auto valueEnd = std::min(line.find(',', valueStart), line.size());
+                    std::string value = line.substr(valueStart, valueEnd - valueStart);
+                    valueStart = valueEnd + 1;
+
+                    // Tiled ends every row but the last with a comma
+                    if (valueEnd == line.size() && value.find_first_not_of(" \t\r") == std::string::npos && !row.empty())
+                        break;
+
+                    long long number;
+                    if (!parseInt(value, number))
+                        throw InvalidParseException(errorPrefix + R"(The value ")" + value + R"(" is not an integer)");
+
+                    row.push_back(number);
+                }
+
+                rows.push_back(std::move(row));
+            }
+
+            return rows;
+        }
+
+        /**
+         * @brief Get an unsigned integer attribute of a TMX element
+         * @param element The element to get the attribute from
+         * @param attribute The name of the attribute
+         * @param errorPrefix The beginning of the message of a thrown exception
+         * @param defaultValue The value returned when the attribute is missing,
+         *                     or a negative value if the attribute is required
+         * @return The value of the attribute
+         * @throws InvalidParseException If the attribute is required and missing
+         *         or if it is not an unsigned integer
+         */
+        unsigned int getUIntAttribute(const priv::XmlElement& element, const std::string& attribute,
+            const std::string& errorPrefix, long long defaultValue = -1)
+        {
+            if (!element.hasAttribute(attribute)) {
+                if (defaultValue < 0)
+                    throw InvalidParseException(errorPrefix + "The '" + element.name + "' element has no '" + attribute + "' attribute");
+
+                return static_cast<unsigned int>(defaultValue);
+            }
+
+            long long value;
+            if (!parseInt(element.getAttribute(attribute), value) || value < 0 || value > 0xFFFFFFFFll)
+                throw InvalidParseException(errorPrefix + "The '" + attribute + "' attribute of '" + element.name + "' is not an unsigned integer");
+
+            return static_cast<unsigned int>(value);
+        }
+
+        /**
+         * @brief Get the directory part of a file path
+         * @param filename The path of a file
+         * @return The directory of the file including the trailing separator,
+         *         or an empty string if the path has no directory
+         */
+        std::string getDirectory(const std::string& filename) {
+            auto separator = filename.find_last_of("/\\");
+            return separator == std::string::npos ? "" : filename.substr(0, separator + 1);
+        }
+
+        /**
+         * @brief Create a spritesheet from an image without a resource path prefix
+         * @param filename The path of the image
+         * @param frameSize The size of each frame
+         * @param spacing The space between frames
+         * @param area The area of the image the frames are in
+         * @return The created spritesheet
+         * @throws FileNotFoundException If the image cannot be found
+         *
+         * Tileset images are relative to their TMX or TSX file and not to
+         * the image directory of the ResourceManager
+         */
+        SpriteSheet loadTileset(const std::string& filename, Vector2u frameSize, Vector2u spacing, UIntRect area) {
+            std::string imageDir = ResourceManager::getInstance()->getPathFor(ResourceType::Image);
+            ResourceManager::getInstance()->setPathFor(ResourceType::Image, "");
+
+            try {
+                SpriteSheet tileset(filename, frameSize, spacing, area);
+                ResourceManager::getInstance()->setPathFor(ResourceType::Image, imageDir);
+                return tileset;
+            } catch (...) {
+                ResourceManager::getInstance()->setPathFor(ResourceType::Image, imageDir);
+                throw;
+            }
+        }
+    }
+
+    TileMap::TileMap(Scene &scene) :
+        Drawable(scene),
+        rows_{0u},
+        colms_{0u},
+        position_{0.0f, 0.0f}
+    {}
+
+    TileMap::Ptr TileMap::create(Scene &scene) {
+        return std::make_unique<TileMap>(scene);
+    }
+
+    std::string TileMap::getClassName() const {
+        return "TileMap";
+    }
+
+    void TileMap::create(const SpriteSheet &tileset, unsigned int rows, unsigned int colms) {
+        tileset_ = tileset;
+        reset(rows, colms);
+    }
+
+    void TileMap::setTileset(const SpriteSheet &tileset) {
+        tileset_ = tileset;
+
+        for (auto& layer : layers_)
+            layer->markAllDirty();
+    }
+
+    const SpriteSheet &TileMap::getTileset() const {
+        return tileset_;
+    }
+
+    Vector2u TileMap::getTileSize() const {
+        return tileset_.getFrameSize();
+    }
+
+    unsigned int TileMap::getRowCount() const {
+        return rows_;
+    }
+
+    unsigned int TileMap::getColumnCount() const {
+        return colms_;
+    }
+
+    void TileMap::setPosition(float x, float y) {
+        if (position_.x == x && position_.y == y)
+            return;
+
+        position_ = {x, y};
+        emitChange(Property{"position", position_});
+    }
+
+    void TileMap::setPosition(const Vector2f &position) {
+        setPosition(position.x, position.y);
+    }
+
+    Vector2f TileMap::getPosition() const {
+        return position_;
+    }
+
+    bool TileMap::addLayer(const std::string &name) {
+        if (hasLayer(name))
+            return false;
+
+        layers_.push_back(std::make_unique<priv::TileMapLayer>(name, rows_, colms_, EMPTY_TILE));
+        return true;
+    }
+
+    bool TileMap::removeLayer(const std::string &name) {
+        auto found = std::find_if(layers_.begin(), layers_.end(), [&name](const auto& layer) {
+            return layer->getName() == name;
+        });
+
+        if (found == layers_.end())
+            return false;
+
+        layers_.erase(found);
+        return true;
+    }
+
+    bool TileMap::hasLayer(const std::string &name) const {
+        return std::any_of(layers_.begin(), layers_.end(), [&name](const auto& layer) {
+            return layer->getName() == name;
+        });
+    }
+
+    std::size_t TileMap::getLayerCount() const {
+        return layers_.size();
+    }
+
+    std::vector<std::string> TileMap::getLayerNames() const {
+        std::vector<std::string> names;
+        names.reserve(layers_.size());
+
+        for (const auto& layer : layers_)
+            names.push_back(layer->getName());
+
+        return names;
+    }
+
+    void TileMap::setLayerVisible(const std::string &name, bool visible) {
+        getLayer(name).setVisible(visible);
+    }
+
+    bool TileMap::isLayerVisible(const std::string &name) const {
+        return getLayer(name).isVisible();
+    }
+
+    void TileMap::setTile(const std::string &layer, const Index &index, int tile) {
+        getLayer(layer).setTile(index, tile);
+    }
+
+    int TileMap::getTile(const std::string &layer, const Index &index) const {
+        return getLayer(layer).getTile(index, EMPTY_TILE);
+    }
+
+    void TileMap::fill(const std::string &layer, int tile) {
+        getLayer(layer).fill(tile);
+    }
+
+    void TileMap::loadFromCSV(const std::string &filename, const std::string &layer) {
+        std::stringstream buffer;
+        utility::DiskFileReader().readFileInto(filename, buffer);
+
+        std::string errorPrefix = R"(Invalid CSV file ")" + filename + R"(": )";
+        auto rows = parseCSV(buffer.str(), errorPrefix);
+        auto colms = rows.empty() ? 0u : static_cast<unsigned int>(rows[0].size());
+
+        for (const auto& row : rows) {
+            if (row.size() != colms)
+                throw InvalidParseException(errorPrefix + "The rows do not have the same number of values");
+        }
+
+        if (layers_.empty())
+            reset(static_cast<unsigned int>(rows.size()), colms);
+        else if (rows.size() != rows_ || colms != colms_)
+            throw InvalidParseException(errorPrefix + "The size of the file does not match the size of the tilemap");
+
+        std::vector<int> tiles;
+        tiles.reserve(static_cast<std::size_t>(rows_) * colms_);
+        for (const auto& row : rows) {
+            for (auto value : row)
+                tiles.push_back(value < 0 || value > 0x7FFFFFFFll ? EMPTY_TILE : static_cast<int>(value));
+        }
+
+        addLayer(layer);
+        getLayer(layer).setTiles(std::move(tiles));
+    }
+
+    void TileMap::loadFromTMX(const std::string &filename) {
+        std::string errorPrefix = R"(Invalid TMX file ")" + filename + R"(": )";
+        priv::XmlElement map = priv::XmlParser::parseFile(filename);
+
+        if (map.name != "map")
+            throw InvalidParseException(errorPrefix + "The root element is not 'map'");
+
+        if (map.getAttribute("orientation", "orthogonal") != "orthogonal")
+            throw InvalidParseException(errorPrefix + "Only orthogonal maps are supported");
+
+        if (map.getAttribute("infinite", "0") != "0")
+            throw InvalidParseException(errorPrefix + "Infinite maps are not supported");
+
+        unsigned int rows = getUIntAttribute(map, "height", errorPrefix);
+        unsigned int colms = getUIntAttribute(map, "width", errorPrefix);
+
+        // Tileset, which is either embedded or stored in an external TSX file
+        auto tilesetCount = std::count_if(map.children.begin(), map.children.end(), [](const priv::XmlElement& child) {
+            return child.name == "tileset";
+        });
+
+        if (tilesetCount != 1)
+            throw InvalidParseException(errorPrefix + "The map must have exactly one tileset");
+
+        const priv::XmlElement* tilesetElement = map.getChild("tileset");
+        unsigned int firstGid = getUIntAttribute(*tilesetElement, "firstgid", errorPrefix, 1);
+        std::string tilesetDir = getDirectory(filename);
+        priv::XmlElement externalTileset;
+
+        if (tilesetElement->hasAttribute("source")) {
+            std::string tilesetFile = tilesetDir + tilesetElement->getAttribute("source");
+            externalTileset = priv::XmlParser::parseFile(tilesetFile);
+            tilesetElement = &externalTileset;
+            tilesetDir = getDirectory(tilesetFile);
+        }
+
+        const priv::XmlElement* image = tilesetElement->getChild("image");
+        if (!image || !image->hasAttribute("source"))
+            throw InvalidParseException(errorPrefix + "The tileset has no image");
+
+        Vector2u tileSize{getUIntAttribute(*tilesetElement, "tilewidth", errorPrefix),
+                          getUIntAttribute(*tilesetElement, "tileheight", errorPrefix)};
+        unsigned int spacing = getUIntAttribute(*tilesetElement, "spacing", errorPrefix, 0);
+        unsigned int margin = getUIntAttribute(*tilesetElement, "margin", errorPrefix, 0);
+        unsigned int tilesetColms = getUIntAttribute(*tilesetElement, "columns", errorPrefix);
+        unsigned int tileCount = getUIntAttribute(*tilesetElement, "tilecount", errorPrefix);
+
+        if (tileSize.x == 0 || tileSize.y == 0 || tilesetColms == 0)
+            throw InvalidParseException(errorPrefix + "The tileset has no tiles");
+
+        // A SpriteSheet has the same spacing before the first frame as between
+        // frames, so the area starts where that spacing fits into the margin
+        if (margin < spacing)
+            throw InvalidParseException(errorPrefix + "A tileset margin smaller than the tile spacing is not supported");
+
+        unsigned int tilesetRows = (tileCount + tilesetColms - 1) / tilesetColms;
+        UIntRect area{margin - spacing, margin - spacing,
+                      tilesetColms * (tileSize.x + spacing) + spacing,
+                      tilesetRows * (tileSize.y + spacing) + spacing};
+
+        SpriteSheet tileset = loadTileset(tilesetDir + image->getAttribute("source"), tileSize, {spacing, spacing}, area);
+
+        // Tile layers
+        std::vector<std::unique_ptr<priv::TileMapLayer>> layers;
+        for (const priv::XmlElement& layerElement : map.children) {
+            if (layerElement.name != "layer")
+                continue;
+
+            std::string name = layerElement.getAttribute("name", "Layer " + std::to_string(layers.size() + 1));
+            const priv::XmlElement* data = layerElement.getChild("data");
+            if (!data)
+                throw InvalidParseException(errorPrefix + R"(The layer ")" + name + R"(" has no data)");
+
+            std::vector<long long> gids;
+            std::string encoding = data->getAttribute("encoding");
+
+            if (encoding == "csv") {
+                for (auto& row : parseCSV(data->text, errorPrefix))
+                    gids.insert(gids.end(), row.begin(), row.end());
+            } else if (encoding.empty()) {
+                for (const priv::XmlElement& tile : data->children) {
+                    if (tile.name == "tile")
+                        gids.push_back(getUIntAttribute(tile, "gid", errorPrefix, 0));
+                }
+            } else
+                throw InvalidParseException(errorPrefix + "The '" + encoding + "' layer encoding is not supported, use CSV");
+
+            if (gids.size() != static_cast<std::size_t>(rows) * colms)
+                throw InvalidParseException(errorPrefix + R"(The size of the data of layer ")" + name + R"(" does not match the size of the map)");
+
+            std::vector<int> tiles;
+            tiles.reserve(gids.size());
+            for (auto gid : gids) {
+                auto id = static_cast<unsigned long>(gid) & ~TMX_FLIP_FLAGS;
+                tiles.push_back(gid <= 0 || id < firstGid ? EMPTY_TILE : static_cast<int>(id - firstGid));
+            }
+
+            auto layer = std::make_unique<priv::TileMapLayer>(name, rows, colms, EMPTY_TILE);
+            layer->setTiles(std::move(tiles));
+            layer->setVisible(layerElement.getAttribute("visible", "1") != "0");
+            layers.push_back(std::move(layer));
+        }
+
+        // Only modify the tilemap after the whole file has been read
+        tileset_ = std::move(tileset);
+        rows_ = rows;
+        colms_ = colms;
+        layers_ = std::move(layers);
+    }
+
+    void TileMap::draw(priv::RenderTarget &renderTarget) const {
+        if (tileset_.getFramesCount() == 0)
+            return;
+
+        for (const auto& layer : layers_) {
+            if (layer->isVisible())
+                layer->draw(renderTarget, tileset_, position_);
+        }
+    }
+
+    priv::TileMapLayer& TileMap::getLayer(const std::string &name) const {
+        auto found = std::find_if(layers_.begin(), layers_.end(), [&name](const auto& layer) {
+            return layer->getName() == name;
+        });
+
+        if (found == layers_.end())
+            throw InvalidArgumentException(R"(The tilemap has no layer named ")" + name + R"(")");
+
+        return **found;
+    }
+
+    void TileMap::reset(unsigned int rows, unsigned int colms) {
+        rows_ = rows;
+        colms_ = colms;
+        layers_.clear();
+    }
+
+    TileMap::~TileMap() = default;
+}
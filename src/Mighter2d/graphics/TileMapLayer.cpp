@@ -0,0 +1,188 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/graphics/TileMapLayer.h"
+#include "Mighter2d/Config.h"
+#include "Mighter2d/graphics/RenderTarget.h"
+#include "Mighter2d/graphics/SpriteSheet.h"
+#include "Mighter2d/graphics/Texture.h"
+#include "Mighter2d/graphics/VisibleChunks.h"
+#include <algorithm>
+
+namespace mighter2d::priv {
+    namespace {
+        /**
+         * @brief Get the key of the batch of a chunk
+         * @param chunkRow The row of the chunk
+         * @param chunkColm The column of the chunk
+         * @return The key of the batch
+         */
+        std::uint64_t getBatchKey(unsigned int chunkRow, unsigned int chunkColm) {
+            return (static_cast<std::uint64_t>(chunkRow) << 32) | chunkColm;
+        }
+    }
+
+    TileMapLayer::TileMapLayer(std::string name, unsigned int rows, unsigned int colms, int tile) :
+        name_{std::move(name)},
+        rows_{rows},
+        colms_{colms},
+        isVisible_{true},
+        tiles_(static_cast<std::size_t>(rows) * colms, tile),
+        frame_{0}
+    {}
+
+    const std::string &TileMapLayer::getName() const {
+        return name_;
+    }
+
+    void TileMapLayer::setVisible(bool visible) {
+        isVisible_ = visible;
+    }
+
+    bool TileMapLayer::isVisible() const {
+        return isVisible_;
+    }
+
+    void TileMapLayer::setTile(const Index &index, int tile) {
+        if (index.row < 0 || index.colm < 0 || static_cast<unsigned int>(index.row) >= rows_ || static_cast<unsigned int>(index.colm) >= colms_)
+            return;
+
+        int& current = tiles_[static_cast<std::size_t>(index.row) * colms_ + static_cast<std::size_t>(index.colm)];
+        if (current == tile)
+            return;
+
+        current = tile;
+        auto batch = batches_.find(getBatchKey(static_cast<unsigned int>(index.row) / CHUNK_SIZE, static_cast<unsigned int>(index.colm) / CHUNK_SIZE));
+        if (batch != batches_.end())
+            batch->second.isDirty = true;
+    }
+
+    int TileMapLayer::getTile(const Index &index, int emptyTile) const {
+        if (index.row < 0 || index.colm < 0 || static_cast<unsigned int>(index.row) >= rows_ || static_cast<unsigned int>(index.colm) >= colms_)
+            return emptyTile;
+
+        return tiles_[static_cast<std::size_t>(index.row) * colms_ + static_cast<std::size_t>(index.colm)];
+    }
+
+    void TileMapLayer::setTiles(std::vector<int> tiles) {
+        MIGHTER2D_ASSERT(tiles.size() == tiles_.size(), "The number of tiles does not match the size of the layer")
+        tiles_ = std::move(tiles);
+        markAllDirty();
+    }
+
+    void TileMapLayer::fill(int tile) {
+        std::fill(tiles_.begin(), tiles_.end(), tile);
+        markAllDirty();
+    }
+
+    void TileMapLayer::markAllDirty() {
+        for (auto& [key, batch] : batches_)
+            batch.isDirty = true;
+    }
+
+    void TileMapLayer::draw(RenderTarget &renderTarget, const SpriteSheet &tileset, const Vector2f &position) {
+        frame_++;
+
+        Vector2u tileSize = tileset.getFrameSize();
+        Vector2f chunkSize{static_cast<float>(CHUNK_SIZE * tileSize.x), static_cast<float>(CHUNK_SIZE * tileSize.y)};
+        auto visibleChunks = getVisibleChunks(renderTarget, position, chunkSize,
+            (rows_ + CHUNK_SIZE - 1) / CHUNK_SIZE, (colms_ + CHUNK_SIZE - 1) / CHUNK_SIZE);
+        std::size_t drawnChunkCount = 0;
+
+        if (visibleChunks) {
+            sf::RenderStates states;
+            states.texture = &tileset.getTexture().getInternalTexture();
+            states.transform.translate(static_cast<float>(position.x), static_cast<float>(position.y));
+
+            for (auto chunkRow = visibleChunks->firstRow; chunkRow <= visibleChunks->lastRow; ++chunkRow) {
+                for (auto chunkColm = visibleChunks->firstColm; chunkColm <= visibleChunks->lastColm; ++chunkColm) {
+                    Batch& batch = batches_[getBatchKey(chunkRow, chunkColm)];
+
+                    if (batch.isDirty)
+                        build(batch, tileset, chunkRow, chunkColm);
+
+                    batch.lastDrawnFrame = frame_;
+                    drawnChunkCount++;
+
+                    if (batch.vertices.getVertexCount() > 0)
+                        renderTarget.draw(batch.vertices, states);
+                }
+            }
+        }
+
+        // Release the vertices of the chunks that scrolled out of view
+        if (batches_.size() > drawnChunkCount) {
+            for (auto iter = batches_.begin(); iter != batches_.end();) {
+                if (iter->second.lastDrawnFrame != frame_)
+                    iter = batches_.erase(iter);
+                else
+                    ++iter;
+            }
+        }
+    }
+
+    void TileMapLayer::build(Batch &batch, const SpriteSheet &tileset, unsigned int chunkRow, unsigned int chunkColm) const {
+        auto firstRow = chunkRow * CHUNK_SIZE;
+        auto firstColm = chunkColm * CHUNK_SIZE;
+        auto lastRow = std::min(firstRow + CHUNK_SIZE, rows_);
+        auto lastColm = std::min(firstColm + CHUNK_SIZE, colms_);
+        auto framesPerRow = static_cast<int>(tileset.getSizeInFrames().x);
+        auto frameCount = static_cast<int>(tileset.getFramesCount());
+        Vector2f tileSize{tileset.getFrameSize()};
+
+        batch.vertices.setPrimitiveType(sf::Triangles);
+        batch.vertices.clear();
+
+        for (auto row = firstRow; row < lastRow; ++row) {
+            float top = static_cast<float>(row) * tileSize.y;
+            float bottom = top + tileSize.y;
+
+            for (auto colm = firstColm; colm < lastColm; ++colm) {
+                int tile = tiles_[static_cast<std::size_t>(row) * colms_ + colm];
+                if (tile < 0 || tile >= frameCount)
+                    continue;
+
+                auto frame = tileset.getFrame(Index{tile / framesPerRow, tile % framesPerRow});
+                if (!frame)
+                    continue;
+
+                float left = static_cast<float>(colm) * tileSize.x;
+                float right = left + tileSize.x;
+                auto texLeft = static_cast<float>(frame->left);
+                auto texTop = static_cast<float>(frame->top);
+                auto texRight = texLeft + static_cast<float>(frame->width);
+                auto texBottom = texTop + static_cast<float>(frame->height);
+
+                batch.vertices.append(sf::Vertex({left, top}, {texLeft, texTop}));
+                batch.vertices.append(sf::Vertex({right, top}, {texRight, texTop}));
+                batch.vertices.append(sf::Vertex({left, bottom}, {texLeft, texBottom}));
+                batch.vertices.append(sf::Vertex({left, bottom}, {texLeft, texBottom}));
+                batch.vertices.append(sf::Vertex({right, top}, {texRight, texTop}));
+                batch.vertices.append(sf::Vertex({right, bottom}, {texRight, texBottom}));
+            }
+        }
+
+        batch.isDirty = false;
+    }
+}
@@ -0,0 +1,158 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_TILEMAPLAYER_H
+#define MIGHTER2D_TILEMAPLAYER_H
+
+#include "Mighter2d/common/Vector2.h"
+#include "Mighter2d/core/grid/Index.h"
+#include <SFML/Graphics/VertexArray.hpp>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mighter2d {
+    class SpriteSheet;
+
+    namespace priv {
+        class RenderTarget;
+
+        /**
+         * @brief A layer of a TileMap
+         *
+         * A layer stores the tileset frame of each of its tiles. The tiles
+         * are grouped into square chunks and each chunk is drawn from a
+         * single vertex array. Only the chunks in view are built and drawn,
+         * and a chunk is only rebuilt after one of its tiles changes
+         */
+        class TileMapLayer {
+        public:
+            static constexpr unsigned int CHUNK_SIZE = 32; //!< The number of tiles along each side of a chunk
+
+            /**
+             * @brief Constructor
+             * @param name The name of the layer
+             * @param rows The number of rows of tiles
+             * @param colms The number of columns of tiles
+             * @param tile The tile to fill the layer with
+             */
+            TileMapLayer(std::string name, unsigned int rows, unsigned int colms, int tile);
+
+            /**
+             * @brief Get the name of the layer
+             * @return The name of the layer
+             */
+            const std::string& getName() const;
+
+            /**
+             * @brief Show or hide the layer
+             * @param visible True to show the layer or false to hide it
+             */
+            void setVisible(bool visible);
+
+            /**
+             * @brief Check if the layer is visible or not
+             * @return True if the layer is visible, otherwise false
+             */
+            bool isVisible() const;
+
+            /**
+             * @brief Set the tile at an index
+             * @param index The index of the tile
+             * @param tile The tileset frame of the tile
+             *
+             * This function has no effect if @a index is out of bounds
+             */
+            void setTile(const Index& index, int tile);
+
+            /**
+             * @brief Get the tile at an index
+             * @param index The index of the tile
+             * @param emptyTile The value returned when @a index is out of bounds
+             * @return The tileset frame of the tile
+             */
+            int getTile(const Index& index, int emptyTile) const;
+
+            /**
+             * @brief Set all the tiles of the layer
+             * @param tiles The tileset frames of the tiles in row-major order
+             *
+             * The number of tiles must be equal to the number of tiles in the layer
+             */
+            void setTiles(std::vector<int> tiles);
+
+            /**
+             * @brief Set all the tiles to the same frame
+             * @param tile The tileset frame to set
+             */
+            void fill(int tile);
+
+            /**
+             * @brief Mark all the chunks as dirty
+             */
+            void markAllDirty();
+
+            /**
+             * @brief Draw the tiles that intersect the view of a render target
+             * @param renderTarget The target to draw the tiles on
+             * @param tileset The tileset the frames of the tiles refer to
+             * @param position The position of the tilemap
+             *
+             * Tiles whose frame is not in the tileset are not drawn
+             */
+            void draw(RenderTarget& renderTarget, const SpriteSheet& tileset, const Vector2f& position);
+
+        private:
+            /**
+             * @brief The vertices of the tiles of a chunk
+             */
+            struct Batch {
+                sf::VertexArray vertices;       //!< Two triangles per non-empty tile
+                bool isDirty = true;            //!< A flag indicating whether or not the vertices are out of date
+                std::size_t lastDrawnFrame = 0; //!< The last frame in which the chunk was drawn
+            };
+
+            /**
+             * @brief Fill the vertex array of a chunk
+             * @param batch The batch to be filled
+             * @param tileset The tileset the frames of the tiles refer to
+             * @param chunkRow The row of the chunk
+             * @param chunkColm The column of the chunk
+             */
+            void build(Batch& batch, const SpriteSheet& tileset, unsigned int chunkRow, unsigned int chunkColm) const;
+
+        private:
+            std::string name_;                                 //!< The name of the layer
+            unsigned int rows_;                                //!< The number of rows of tiles
+            unsigned int colms_;                               //!< The number of columns of tiles
+            bool isVisible_;                                   //!< A flag indicating whether or not the layer is visible
+            std::vector<int> tiles_;                           //!< The tileset frame of each tile in row-major order
+            std::unordered_map<std::uint64_t, Batch> batches_; //!< The batches of the visible chunks (key = chunk row and column)
+            std::size_t frame_;                                //!< The number of calls to draw()
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,71 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/graphics/VisibleChunks.h"
+#include "Mighter2d/graphics/RenderTarget.h"
+#include <algorithm>
+
+namespace mighter2d::priv {
+    namespace {
+        /**
+         * @brief Get the range of chunks intersected by an interval
+         * @param start The start of the interval relative to the first chunk
+         * @param end The end of the interval relative to the first chunk
+         * @param chunkLength The length of a chunk along the axis
+         * @param chunkCount The number of chunks along the axis
+         * @param first The first chunk in the interval
+         * @param last The last chunk in the interval
+         * @return True if the interval intersects a chunk, otherwise false
+         */
+        bool getChunkRange(float start, float end, float chunkLength, unsigned int chunkCount,
+            unsigned int& first, unsigned int& last)
+        {
+            if (chunkCount == 0 || chunkLength <= 0.0f || end < 0.0f || start >= chunkLength * static_cast<float>(chunkCount))
+                return false;
+
+            first = static_cast<unsigned int>(std::max(0.0f, start) / chunkLength);
+            last = static_cast<unsigned int>(std::min(end / chunkLength, static_cast<float>(chunkCount - 1)));
+            return true;
+        }
+    }
+
+    std::optional<ChunkRange> getVisibleChunks(const RenderTarget& renderTarget, const Vector2f& position,
+        const Vector2f& chunkSize, unsigned int rows, unsigned int colms)
+    {
+        // The bounds of the inverse transform account for a rotated view
+        const sf::View& view = renderTarget.getThirdPartyWindow().getView();
+        sf::FloatRect visibleArea = view.getInverseTransform().transformRect({-1.0f, -1.0f, 2.0f, 2.0f});
+        float left = visibleArea.left - static_cast<float>(position.x);
+        float top = visibleArea.top - static_cast<float>(position.y);
+
+        ChunkRange range{};
+        if (getChunkRange(left, left + visibleArea.width, static_cast<float>(chunkSize.x), colms, range.firstColm, range.lastColm)
+            && getChunkRange(top, top + visibleArea.height, static_cast<float>(chunkSize.y), rows, range.firstRow, range.lastRow))
+        {
+            return range;
+        }
+
+        return std::nullopt;
+    }
+}
@@ -0,0 +1,61 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_VISIBLECHUNKS_H
+#define MIGHTER2D_VISIBLECHUNKS_H
+
+#include "Mighter2d/common/Vector2.h"
+#include <optional>
+
+namespace mighter2d::priv {
+    class RenderTarget;
+
+    /**
+     * @brief A rectangular range of chunks (the bounds are inclusive)
+     */
+    struct ChunkRange {
+        unsigned int firstRow;  //!< The first row of chunks in the range
+        unsigned int lastRow;   //!< The last row of chunks in the range
+        unsigned int firstColm; //!< The first column of chunks in the range
+        unsigned int lastColm;  //!< The last column of chunks in the range
+    };
+
+    /**
+     * @brief Get the chunks of a chunked drawable that are in view
+     * @param renderTarget The render target whose view is checked
+     * @param position The position of the top-left corner of the first chunk
+     * @param chunkSize The size of each chunk in pixels
+     * @param rows The number of rows of chunks
+     * @param colms The number of columns of chunks
+     * @return The chunks that intersect the view of the render target, or no
+     *         value if none of the chunks is in view
+     *
+     * The bounds of a rotated view are used, so the range may include chunks
+     * near the corners of the view that are not actually visible
+     */
+    std::optional<ChunkRange> getVisibleChunks(const RenderTarget& renderTarget, const Vector2f& position,
+        const Vector2f& chunkSize, unsigned int rows, unsigned int colms);
+}
+
+#endif
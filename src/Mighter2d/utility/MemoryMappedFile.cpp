@@ -0,0 +1,149 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/utility/MemoryMappedFile.h"
+#include "Mighter2d/core/exceptions/Exceptions.h"
+
+#ifdef MIGHTER2D_SYSTEM_WINDOWS
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace mighter2d::priv {
+    MemoryMappedFile::MemoryMappedFile() :
+        data_{nullptr},
+        size_{0},
+        isOpen_{false}
+    #ifdef MIGHTER2D_SYSTEM_WINDOWS
+        , fileHandle_{nullptr},
+        mappingHandle_{nullptr}
+    #endif
+    {}
+
+    void MemoryMappedFile::open(const std::string &filename) {
+        close();
+
+    #ifdef MIGHTER2D_SYSTEM_WINDOWS
+        HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        LARGE_INTEGER size;
+        if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &size)) {
+            if (file != INVALID_HANDLE_VALUE)
+                CloseHandle(file);
+
+            throw FileNotFoundException(R"(Cannot find file ")" + filename + R"(")");
+        }
+
+        // An empty file cannot be mapped
+        if (size.QuadPart > 0) {
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            const void* data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+            if (!data) {
+                if (mapping)
+                    CloseHandle(mapping);
+
+                CloseHandle(file);
+                throw FileNotFoundException(R"(Cannot map file ")" + filename + R"(")");
+            }
+
+            mappingHandle_ = mapping;
+            data_ = static_cast<const char*>(data);
+        }
+
+        fileHandle_ = file;
+        size_ = static_cast<std::size_t>(size.QuadPart);
+    #else
+        int file = ::open(filename.c_str(), O_RDONLY);
+        struct stat status{};
+        if (file == -1 || fstat(file, &status) == -1) {
+            if (file != -1)
+                ::close(file);
+
+            throw FileNotFoundException(R"(Cannot find file ")" + filename + R"(")");
+        }
+
+        // An empty file cannot be mapped
+        if (status.st_size > 0) {
+            void* data = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+            if (data == MAP_FAILED) {
+                ::close(file);
+                throw FileNotFoundException(R"(Cannot map file ")" + filename + R"(")");
+            }
+
+            data_ = static_cast<const char*>(data);
+        }
+
+        // The mapping remains valid after the file is closed
+        ::close(file);
+        size_ = static_cast<std::size_t>(status.st_size);
+    #endif
+
+        isOpen_ = true;
+    }
+
+    void MemoryMappedFile::close() {
+        if (!isOpen_)
+            return;
+
+    #ifdef MIGHTER2D_SYSTEM_WINDOWS
+        if (data_)
+            UnmapViewOfFile(data_);
+
+        if (mappingHandle_)
+            CloseHandle(mappingHandle_);
+
+        CloseHandle(fileHandle_);
+        fileHandle_ = mappingHandle_ = nullptr;
+    #else
+        if (data_)
+            munmap(const_cast<char*>(data_), size_);
+    #endif
+
+        data_ = nullptr;
+        size_ = 0;
+        isOpen_ = false;
+    }
+
+    bool MemoryMappedFile::isOpen() const {
+        return isOpen_;
+    }
+
+    const char *MemoryMappedFile::getData() const {
+        return data_;
+    }
+
+    std::size_t MemoryMappedFile::getSize() const {
+        return size_;
+    }
+
+    MemoryMappedFile::~MemoryMappedFile() {
+        close();
+    }
+}
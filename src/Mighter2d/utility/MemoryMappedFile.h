@@ -0,0 +1,110 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_MEMORYMAPPEDFILE_H
+#define MIGHTER2D_MEMORYMAPPEDFILE_H
+
+#include "Mighter2d/Config.h"
+#include <cstddef>
+#include <string>
+
+namespace mighter2d::priv {
+    /**
+     * @brief Read-only view of a file mapped into memory
+     *
+     * The pages of the file are loaded by the operating system when they
+     * are first accessed and can be dropped again under memory pressure,
+     * so the file may be larger than the available memory
+     */
+    class MemoryMappedFile {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * The file is not open
+         */
+        MemoryMappedFile();
+
+        /**
+         * @brief Copy constructor
+         */
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        /**
+         * @brief Map a file into memory
+         * @param filename The name of the file to be mapped
+         * @throws FileNotFoundException If @a filename cannot be opened for reading
+         *
+         * The previously mapped file, if any, is unmapped first
+         */
+        void open(const std::string& filename);
+
+        /**
+         * @brief Unmap the file
+         */
+        void close();
+
+        /**
+         * @brief Check if a file is mapped or not
+         * @return True if a file is mapped, otherwise false
+         */
+        bool isOpen() const;
+
+        /**
+         * @brief Get the content of the file
+         * @return The content of the file or a nullptr if no file is mapped
+         *         or the file is empty
+         */
+        const char* getData() const;
+
+        /**
+         * @brief Get the size of the file
+         * @return The size of the file in bytes
+         */
+        std::size_t getSize() const;
+
+        /**
+         * @brief Destructor
+         *
+         * Unmaps the file
+         */
+        ~MemoryMappedFile();
+
+    private:
+        const char* data_;       //!< The content of the file
+        std::size_t size_;       //!< The size of the file in bytes
+        bool isOpen_;            //!< A flag indicating whether or not a file is mapped
+    #ifdef MIGHTER2D_SYSTEM_WINDOWS
+        void* fileHandle_;       //!< Handle of the mapped file
+        void* mappingHandle_;    //!< Handle of the file mapping
+    #endif
+    };
+}
+
+#endif
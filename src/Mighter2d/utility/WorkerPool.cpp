@@ -0,0 +1,102 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/utility/WorkerPool.h"
+#include "Mighter2d/Config.h"
+
+namespace mighter2d::priv {
+    WorkerPool::WorkerPool(unsigned int threadCount) :
+        task_{nullptr},
+        generation_{0},
+        pendingCount_{0},
+        isStopping_{false}
+    {
+        MIGHTER2D_ASSERT(threadCount > 0, "A worker pool needs at least one thread")
+
+        for (std::size_t i = 1; i < threadCount; i++)
+            workers_.emplace_back(&WorkerPool::workerLoop, this, i);
+    }
+
+    unsigned int WorkerPool::getThreadCount() const {
+        return static_cast<unsigned int>(workers_.size() + 1);
+    }
+
+    void WorkerPool::run(const Task &task) {
+        if (!workers_.empty()) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = &task;
+            pendingCount_ = workers_.size();
+            generation_++;
+        }
+
+        taskReady_.notify_all();
+        task(0);
+
+        if (!workers_.empty()) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            taskDone_.wait(lock, [this] { return pendingCount_ == 0; });
+            task_ = nullptr;
+        }
+    }
+
+    void WorkerPool::workerLoop(std::size_t index) {
+        std::uint64_t lastGeneration = 0;
+
+        while (true) {
+            const Task* task;
+
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                taskReady_.wait(lock, [this, lastGeneration] { return isStopping_ || generation_ != lastGeneration; });
+
+                if (isStopping_)
+                    return;
+
+                lastGeneration = generation_;
+                task = task_;
+            }
+
+            (*task)(index);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                pendingCount_--;
+            }
+
+            taskDone_.notify_one();
+        }
+    }
+
+    WorkerPool::~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            isStopping_ = true;
+        }
+
+        taskReady_.notify_all();
+
+        for (auto& worker : workers_)
+            worker.join();
+    }
+}
@@ -0,0 +1,111 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_WORKERPOOL_H
+#define MIGHTER2D_WORKERPOOL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mighter2d::priv {
+    /**
+     * @brief Runs a task on a fixed number of threads at the same time
+     *
+     * The calling thread always takes part in the task, so a pool with
+     * a thread count of N only spawns N - 1 worker threads. The worker
+     * threads sleep between tasks
+     */
+    class WorkerPool {
+    public:
+        /**
+         * @brief Task executed by every thread of the pool
+         *
+         * The task receives the index of the thread executing it, the index
+         * is in the range [0, getThreadCount()) and the calling thread always
+         * has index 0
+         */
+        using Task = std::function<void(std::size_t)>;
+
+        /**
+         * @brief Constructor
+         * @param threadCount The number of threads executing a task, including the calling thread
+         */
+        explicit WorkerPool(unsigned int threadCount);
+
+        /**
+         * @brief Copy constructor
+         */
+        WorkerPool(const WorkerPool&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        /**
+         * @brief Get the number of threads executing a task
+         * @return The number of threads, including the calling thread
+         */
+        unsigned int getThreadCount() const;
+
+        /**
+         * @brief Execute a task on all the threads of the pool
+         * @param task The task to be executed
+         *
+         * This function blocks until every thread finished executing
+         * @a task. The task must not throw exceptions
+         */
+        void run(const Task& task);
+
+        /**
+         * @brief Destructor
+         *
+         * Joins the worker threads
+         */
+        ~WorkerPool();
+
+    private:
+        /**
+         * @brief Loop executed by a worker thread
+         * @param index The index passed to the tasks executed by the thread
+         */
+        void workerLoop(std::size_t index);
+
+    private:
+        std::vector<std::thread> workers_;     //!< Worker threads
+        std::mutex mutex_;                     //!< Guards the state shared with the workers
+        std::condition_variable taskReady_;    //!< Wakes up the workers when a task is available
+        std::condition_variable taskDone_;     //!< Wakes up the calling thread when the workers are done
+        const Task* task_;                     //!< The task being executed
+        std::uint64_t generation_;             //!< Incremented every time a task is submitted
+        std::size_t pendingCount_;             //!< The number of workers still executing the task
+        bool isStopping_;                      //!< A flag indicating whether or not the workers must exit
+    };
+}
+
+#endif
@@ -0,0 +1,312 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/utility/XmlParser.h"
+#include "Mighter2d/core/exceptions/Exceptions.h"
+#include "Mighter2d/utility/DiskFileReader.h"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+namespace mighter2d::priv {
+    namespace {
+        /**
+         * @brief Append a code point to a string in UTF-8
+         * @param codePoint The code point to be appended
+         * @param text The string to append the code point to
+         */
+        void appendUtf8(unsigned long codePoint, std::string& text) {
+            if (codePoint < 0x80)
+                text += static_cast<char>(codePoint);
+            else if (codePoint < 0x800) {
+                text += static_cast<char>(0xC0 | (codePoint >> 6));
+                text += static_cast<char>(0x80 | (codePoint & 0x3F));
+            } else if (codePoint < 0x10000) {
+                text += static_cast<char>(0xE0 | (codePoint >> 12));
+                text += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                text += static_cast<char>(0x80 | (codePoint & 0x3F));
+            } else {
+                text += static_cast<char>(0xF0 | (codePoint >> 18));
+                text += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                text += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                text += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+        }
+
+        /**
+         * @brief Reads the elements of an XML document
+         */
+        class Reader {
+        public:
+            explicit Reader(const std::string& document) :
+                document_{document},
+                pos_{0}
+            {}
+
+            XmlElement readDocument() {
+                skipMisc();
+                if (!startsWith("<"))
+                    error("Expected the root element");
+
+                XmlElement root = readElement();
+                skipMisc();
+
+                if (pos_ != document_.size())
+                    error("Unexpected content after the root element");
+
+                return root;
+            }
+
+        private:
+            [[noreturn]] void error(const std::string& message) const {
+                auto end = document_.begin() + static_cast<std::ptrdiff_t>(std::min(pos_, document_.size()));
+                auto line = std::count(document_.begin(), end, '\n') + 1;
+                throw InvalidParseException("Invalid XML (line " + std::to_string(line) + "): " + message);
+            }
+
+            bool startsWith(const char* token) const {
+                return document_.compare(pos_, std::strlen(token), token) == 0;
+            }
+
+            void expect(char character) {
+                if (pos_ >= document_.size() || document_[pos_] != character)
+                    error(std::string("Expected '") + character + "'");
+
+                ++pos_;
+            }
+
+            void skipWhitespace() {
+                while (pos_ < document_.size() && std::isspace(static_cast<unsigned char>(document_[pos_])))
+                    ++pos_;
+            }
+
+            void skipPast(const char* token) {
+                auto end = document_.find(token, pos_);
+                if (end == std::string::npos)
+                    error(std::string("Missing '") + token + "'");
+
+                pos_ = end + std::strlen(token);
+            }
+
+            // Skips whitespace, the XML declaration, processing instructions,
+            // comments and the document type declaration
+            void skipMisc() {
+                while (true) {
+                    skipWhitespace();
+
+                    if (startsWith("<?"))
+                        skipPast("?>");
+                    else if (startsWith("<!--"))
+                        skipPast("-->");
+                    else if (startsWith("<!DOCTYPE"))
+                        skipDoctype();
+                    else
+                        return;
+                }
+            }
+
+            void skipDoctype() {
+                int depth = 0;
+                for (; pos_ < document_.size(); ++pos_) {
+                    if (document_[pos_] == '[')
+                        depth++;
+                    else if (document_[pos_] == ']')
+                        depth--;
+                    else if (document_[pos_] == '>' && depth == 0) {
+                        ++pos_;
+                        return;
+                    }
+                }
+
+                error("Unterminated document type declaration");
+            }
+
+            std::string readName() {
+                auto start = pos_;
+                while (pos_ < document_.size()) {
+                    auto character = static_cast<unsigned char>(document_[pos_]);
+                    if (character == '\0' || (!std::isalnum(character) && character < 0x80 && !std::strchr("_:-.", character)))
+                        break;
+
+                    ++pos_;
+                }
+
+                if (start == pos_)
+                    error("Expected a name");
+
+                return document_.substr(start, pos_ - start);
+            }
+
+            // Replaces the character references in document_[start, end)
+            std::string decode(std::size_t start, std::size_t end) const {
+                std::string text;
+                text.reserve(end - start);
+
+                while (start < end) {
+                    auto ampersand = document_.find('&', start);
+                    if (ampersand == std::string::npos || ampersand >= end) {
+                        text.append(document_, start, end - start);
+                        break;
+                    }
+
+                    text.append(document_, start, ampersand - start);
+                    auto semicolon = document_.find(';', ampersand);
+                    if (semicolon == std::string::npos || semicolon >= end)
+                        error("Unterminated character reference");
+
+                    std::string reference = document_.substr(ampersand + 1, semicolon - ampersand - 1);
+                    if (reference == "lt")
+                        text += '<';
+                    else if (reference == "gt")
+                        text += '>';
+                    else if (reference == "amp")
+                        text += '&';
+                    else if (reference == "quot")
+                        text += '"';
+                    else if (reference == "apos")
+                        text += '\'';
+                    else if (reference.size() > 1 && reference[0] == '#') {
+                        bool isHex = reference[1] == 'x';
+                        std::string digits = reference.substr(isHex ? 2 : 1);
+                        char* digitsEnd = nullptr;
+                        unsigned long codePoint = std::strtoul(digits.c_str(), &digitsEnd, isHex ? 16 : 10);
+
+                        if (digits.empty() || *digitsEnd != '\0' || codePoint > 0x10FFFF)
+                            error("Invalid character reference '&" + reference + ";'");
+
+                        appendUtf8(codePoint, text);
+                    } else
+                        error("Unknown entity '&" + reference + ";'");
+
+                    start = semicolon + 1;
+                }
+
+                return text;
+            }
+
+            XmlElement readElement() {
+                expect('<');
+                XmlElement element;
+                element.name = readName();
+
+                while (true) {
+                    skipWhitespace();
+
+                    if (startsWith("/>")) {
+                        pos_ += 2;
+                        return element;
+                    } else if (startsWith(">")) {
+                        ++pos_;
+                        break;
+                    }
+
+                    std::string attribute = readName();
+                    skipWhitespace();
+                    expect('=');
+                    skipWhitespace();
+
+                    char quote = pos_ < document_.size() ? document_[pos_] : '\0';
+                    if (quote != '"' && quote != '\'')
+                        error("Expected a quoted value for attribute '" + attribute + "'");
+
+                    auto end = document_.find(quote, ++pos_);
+                    if (end == std::string::npos)
+                        error("Unterminated value for attribute '" + attribute + "'");
+
+                    element.attributes.emplace_back(std::move(attribute), decode(pos_, end));
+                    pos_ = end + 1;
+                }
+
+                while (true) {
+                    if (pos_ >= document_.size())
+                        error("Missing the end tag of '" + element.name + "'");
+
+                    if (startsWith("</")) {
+                        pos_ += 2;
+                        if (readName() != element.name)
+                            error("Mismatched end tag of '" + element.name + "'");
+
+                        skipWhitespace();
+                        expect('>');
+                        return element;
+                    } else if (startsWith("<!--"))
+                        skipPast("-->");
+                    else if (startsWith("<![CDATA[")) {
+                        pos_ += 9;
+                        auto end = document_.find("]]>", pos_);
+                        if (end == std::string::npos)
+                            error("Unterminated CDATA section");
+
+                        element.text.append(document_, pos_, end - pos_);
+                        pos_ = end + 3;
+                    } else if (startsWith("<?"))
+                        skipPast("?>");
+                    else if (startsWith("<"))
+                        element.children.push_back(readElement());
+                    else {
+                        auto end = std::min(document_.find('<', pos_), document_.size());
+                        element.text += decode(pos_, end);
+                        pos_ = end;
+                    }
+                }
+            }
+
+        private:
+            const std::string& document_;
+            std::size_t pos_;
+        };
+    }
+
+    bool XmlElement::hasAttribute(const std::string &attribute) const {
+        return std::any_of(attributes.begin(), attributes.end(), [&attribute](const auto& pair) {
+            return pair.first == attribute;
+        });
+    }
+
+    std::string XmlElement::getAttribute(const std::string &attribute, const std::string &defaultValue) const {
+        auto found = std::find_if(attributes.begin(), attributes.end(), [&attribute](const auto& pair) {
+            return pair.first == attribute;
+        });
+
+        return found != attributes.end() ? found->second : defaultValue;
+    }
+
+    const XmlElement* XmlElement::getChild(const std::string &childName) const {
+        auto found = std::find_if(children.begin(), children.end(), [&childName](const XmlElement& child) {
+            return child.name == childName;
+        });
+
+        return found != children.end() ? &(*found) : nullptr;
+    }
+
+    XmlElement XmlParser::parse(const std::string &document) {
+        return Reader(document).readDocument();
+    }
+
+    XmlElement XmlParser::parseFile(const std::string &filename) {
+        std::stringstream buffer;
+        utility::DiskFileReader().readFileInto(filename, buffer);
+        return parse(buffer.str());
+    }
+}
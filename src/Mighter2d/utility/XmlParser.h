@@ -0,0 +1,97 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_XMLPARSER_H
+#define MIGHTER2D_XMLPARSER_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mighter2d::priv {
+    /**
+     * @brief An element of an XML document
+     */
+    struct XmlElement {
+        std::string name;                                              //!< The name of the element
+        std::vector<std::pair<std::string, std::string>> attributes;   //!< The attributes of the element in document order
+        std::vector<XmlElement> children;                              //!< The child elements in document order
+        std::string text;                                              //!< The character data directly inside the element
+
+        /**
+         * @brief Check if the element has an attribute or not
+         * @param attribute The name of the attribute to be checked
+         * @return True if the element has the attribute, otherwise false
+         */
+        bool hasAttribute(const std::string& attribute) const;
+
+        /**
+         * @brief Get the value of an attribute
+         * @param attribute The name of the attribute
+         * @param defaultValue The value returned when the element does not
+         *                     have the attribute
+         * @return The value of the attribute
+         */
+        std::string getAttribute(const std::string& attribute, const std::string& defaultValue = "") const;
+
+        /**
+         * @brief Get the first child with a given name
+         * @param childName The name of the child
+         * @return The first child with the given name or a nullptr if the
+         *         element has no such child
+         */
+        const XmlElement* getChild(const std::string& childName) const;
+    };
+
+    /**
+     * @brief Reads XML documents
+     *
+     * The parser supports the subset of XML used by data files: elements,
+     * attributes, character data, CDATA sections and the predefined and
+     * numeric character references. The XML declaration, processing
+     * instructions, comments and the document type declaration are skipped.
+     * Namespaces are not interpreted and the document is not validated
+     */
+    class XmlParser {
+    public:
+        /**
+         * @brief Parse an XML document
+         * @param document The XML document
+         * @return The root element of the document
+         * @throws InvalidParseException If @a document is not well-formed
+         */
+        static XmlElement parse(const std::string& document);
+
+        /**
+         * @brief Parse an XML file
+         * @param filename The name of the XML file
+         * @return The root element of the document
+         * @throws FileNotFoundException If @a filename cannot be opened
+         * @throws InvalidParseException If the file is not well-formed
+         */
+        static XmlElement parseFile(const std::string& filename);
+    };
+}
+
+#endif
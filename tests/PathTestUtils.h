@@ -0,0 +1,157 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#ifndef MIGHTER2D_PATHTESTUTILS_H
+#define MIGHTER2D_PATHTESTUTILS_H
+
+#include "Mighter2d/core/grid/Grid.h"
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace mighter2d {
+    /// Helpers shared by the tests of the path finding classes
+    namespace test {
+        const float DIAGONAL_COST = 1.41421356f;
+
+        /**
+         * @brief Load a grid of random size
+         * @param grid The grid to be loaded
+         * @param engine The random number generator
+         * @param maxSize The maximum number of rows and columns
+         * @param hasObstacles True to make up to 44 percent of the tiles collidable
+         * @param isWeighted True to give the tiles a random movement cost from 1 to 4
+         *
+         * Tiles with the ids '1' to '4' cost as much as their id, '#' tiles are collidable
+         */
+        inline void createRandomGrid(Grid& grid, std::mt19937& engine, int maxSize, bool hasObstacles, bool isWeighted) {
+            std::uniform_int_distribution<int> size(1, maxSize);
+            std::uniform_int_distribution<int> percentage(0, 99);
+            std::uniform_int_distribution<int> cost(1, isWeighted ? 4 : 1);
+            const int obstaclePercentage = hasObstacles ? percentage(engine) % 45 : 0;
+
+            Map map(static_cast<std::size_t>(size(engine)), std::vector<char>(static_cast<std::size_t>(size(engine))));
+            for (auto& row : map) {
+                for (auto& id : row)
+                    id = hasObstacles && percentage(engine) < obstaclePercentage ? '#' : static_cast<char>('0' + cost(engine));
+            }
+
+            grid.loadFromVector(map);
+            grid.setCollidableById('#', true);
+
+            for (char id = '1'; id <= '4'; id++)
+                grid.setMovementCostById(id, static_cast<float>(id - '0'));
+        }
+
+        /**
+         * @brief Get the index of a random tile in a grid
+         * @param grid The grid to pick a tile from
+         * @param engine The random number generator
+         * @return The index of the tile
+         */
+        inline Index getRandomIndex(const Grid& grid, std::mt19937& engine) {
+            std::uniform_int_distribution<int> row(0, static_cast<int>(grid.getSizeInTiles().y) - 1);
+            std::uniform_int_distribution<int> colm(0, static_cast<int>(grid.getSizeInTiles().x) - 1);
+            return Index{row(engine), colm(engine)};
+        }
+
+        /**
+         * @brief Check if a diagonal move does not cut the corner of an inaccessible tile
+         * @param grid The grid the move is made in
+         * @param from The tile moved from
+         * @param to The tile moved to
+         * @return True if both tiles beside the move can be entered, otherwise false
+         */
+        inline bool isDiagonalMoveValid(const Grid& grid, const Index& from, const Index& to) {
+            return grid.isTileAccessible(Index{from.row, to.colm}) && grid.isTileAccessible(Index{to.row, from.colm});
+        }
+
+        /**
+         * @brief Reference Dijkstra search
+         * @param grid The grid to be searched
+         * @param start The tile the search starts from
+         * @param isDiagonalAllowed True to allow diagonal moves, otherwise false
+         * @param isReversed False to find the costs of moving from @a start to
+         *                   every tile, true to find the costs of moving from
+         *                   every tile to @a start
+         * @return The cheapest cost of each tile in row major order, or -1 if
+         *         the tile cannot be reached
+         *
+         * A move costs the movement cost of the tile moved into, times
+         * DIAGONAL_COST for diagonal moves. A mover may leave a tile that
+         * cannot be entered, so a forward search from such a tile still
+         * finds costs, however a reversed search towards it does not
+         */
+        inline std::vector<float> findCheapestCosts(const Grid& grid, const Index& start, bool isDiagonalAllowed, bool isReversed) {
+            const int colms = static_cast<int>(grid.getSizeInTiles().x);
+            const int rows = static_cast<int>(grid.getSizeInTiles().y);
+            std::vector<float> costs(static_cast<std::size_t>(rows * colms), -1.0f);
+
+            if (isReversed && !grid.isTileAccessible(start))
+                return costs;
+
+            using Node = std::pair<float, Index>;
+            auto isCostlier = [](const Node& a, const Node& b) { return a.first > b.first; };
+            std::priority_queue<Node, std::vector<Node>, decltype(isCostlier)> openSet(isCostlier);
+            costs[static_cast<std::size_t>(start.row * colms + start.colm)] = 0.0f;
+            openSet.push({0.0f, start});
+
+            while (!openSet.empty()) {
+                auto [cost, index] = openSet.top();
+                openSet.pop();
+
+                if (cost > costs[static_cast<std::size_t>(index.row * colms + index.colm)])
+                    continue;
+
+                for (int rowStep = -1; rowStep <= 1; rowStep++) {
+                    for (int colmStep = -1; colmStep <= 1; colmStep++) {
+                        bool isDiagonal = rowStep != 0 && colmStep != 0;
+                        Index neighbour{index.row + rowStep, index.colm + colmStep};
+
+                        if ((rowStep == 0 && colmStep == 0) || (isDiagonal && !isDiagonalAllowed) || !grid.isTileAccessible(neighbour))
+                            continue;
+
+                        if (isDiagonal && !isDiagonalMoveValid(grid, index, neighbour))
+                            continue;
+
+                        // A reversed search moves from the neighbour into the current tile
+                        const Index& enteredTile = isReversed ? index : neighbour;
+                        float neighbourCost = cost + grid.getMovementCost(enteredTile) * (isDiagonal ? DIAGONAL_COST : 1.0f);
+                        float& bestCost = costs[static_cast<std::size_t>(neighbour.row * colms + neighbour.colm)];
+
+                        if (bestCost < 0.0f || neighbourCost < bestCost) {
+                            bestCost = neighbourCost;
+                            openSet.push({neighbourCost, neighbour});
+                        }
+                    }
+                }
+            }
+
+            return costs;
+        }
+    }
+}
+
+#endif // MIGHTER2D_PATHTESTUTILS_H
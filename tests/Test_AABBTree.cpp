@@ -0,0 +1,213 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/physics/AABBTree.h"
+#include <doctest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using mighter2d::Vector2f;
+using mighter2d::priv::AABB;
+using mighter2d::priv::AABBTree;
+
+namespace {
+    AABB createRandomAABB(std::mt19937& engine) {
+        std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+        std::uniform_real_distribution<float> size(0.0f, 60.0f);
+
+        Vector2f min{position(engine), position(engine)};
+        return AABB{min, Vector2f{min.x + size(engine), min.y + size(engine)}};
+    }
+
+    AABB grow(const AABB& aabb, float amount) {
+        return AABB{Vector2f{aabb.min.x - amount, aabb.min.y - amount}, Vector2f{aabb.max.x + amount, aabb.max.y + amount}};
+    }
+
+    // Reference slab test of a line segment against a box
+    bool isCrossed(const AABB& aabb, const Vector2f& from, const Vector2f& to) {
+        float tMin = 0.0f, tMax = 1.0f;
+        const float origin[2] = {from.x, from.y};
+        const float direction[2] = {to.x - from.x, to.y - from.y};
+        const float lower[2] = {aabb.min.x, aabb.min.y};
+        const float upper[2] = {aabb.max.x, aabb.max.y};
+
+        for (int axis = 0; axis < 2; axis++) {
+            if (direction[axis] == 0.0f) {
+                if (origin[axis] < lower[axis] || origin[axis] > upper[axis])
+                    return false;
+            } else {
+                float t1 = (lower[axis] - origin[axis]) / direction[axis];
+                float t2 = (upper[axis] - origin[axis]) / direction[axis];
+                tMin = std::max(tMin, std::min(t1, t2));
+                tMax = std::min(tMax, std::max(t1, t2));
+
+                if (tMin > tMax)
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    // The proxies of a tree and the AABBs they were last given
+    struct Proxies {
+        std::vector<int> ids;
+        std::vector<AABB> aabbs;
+        std::vector<bool> isInUse;
+    };
+
+    void checkQueries(const AABBTree& tree, const Proxies& proxies, std::mt19937& engine) {
+        for (int queryCount = 0; queryCount < 20; queryCount++) {
+            const AABB queryAABB = createRandomAABB(engine);
+            std::multiset<int> found;
+            tree.query(queryAABB, [&found](int userData) { found.insert(userData); });
+
+            std::multiset<int> expected;
+            for (std::size_t i = 0; i < proxies.ids.size(); i++) {
+                if (proxies.isInUse[i] && tree.getFatAABB(proxies.ids[i]).overlaps(queryAABB))
+                    expected.insert(static_cast<int>(i));
+            }
+
+            REQUIRE(found == expected);
+        }
+    }
+}
+
+TEST_CASE("mighter2d::priv::AABBTree class")
+{
+    std::mt19937 engine(2035);
+    AABBTree tree(4.0f);
+    Proxies proxies;
+
+    for (int i = 0; i < 200; i++) {
+        proxies.aabbs.push_back(createRandomAABB(engine));
+        proxies.ids.push_back(tree.createProxy(proxies.aabbs.back(), i));
+        proxies.isInUse.push_back(true);
+    }
+
+    SUBCASE("Fat AABBs contain the AABBs of their proxies")
+    {
+        REQUIRE_EQ(tree.getProxyCount(), 200);
+
+        for (std::size_t i = 0; i < proxies.ids.size(); i++) {
+            CHECK_EQ(tree.getUserData(proxies.ids[i]), static_cast<int>(i));
+            CHECK(tree.getFatAABB(proxies.ids[i]).contains(proxies.aabbs[i]));
+        }
+    }
+
+    SUBCASE("Queries match a brute force search as proxies move and are destroyed")
+    {
+        std::uniform_real_distribution<float> step(-6.0f, 6.0f);
+
+        for (int frame = 0; frame < 30; frame++) {
+            for (std::size_t i = 0; i < proxies.ids.size(); i++) {
+                if (!proxies.isInUse[i])
+                    continue;
+
+                if (engine() % 50 == 0) {
+                    tree.destroyProxy(proxies.ids[i]);
+                    proxies.isInUse[i] = false;
+                    continue;
+                }
+
+                // Small moves stay inside the fat AABB, large moves reinsert the proxy
+                Vector2f offset = engine() % 10 == 0 ? Vector2f{step(engine) * 20.0f, step(engine) * 20.0f} : Vector2f{step(engine), step(engine)};
+                AABB& aabb = proxies.aabbs[i];
+                aabb = AABB{aabb.min + offset, aabb.max + offset};
+
+                bool wasInside = tree.getFatAABB(proxies.ids[i]).contains(aabb);
+                CHECK_EQ(tree.moveProxy(proxies.ids[i], aabb), !wasInside);
+                REQUIRE(tree.getFatAABB(proxies.ids[i]).contains(aabb));
+            }
+
+            checkQueries(tree, proxies, engine);
+        }
+
+        // A balanced tree of n leaves is about log2(n) high, allow some slack for the rotations
+        const auto proxyCount = static_cast<float>(tree.getProxyCount());
+        CHECK_LE(tree.getHeight(), static_cast<int>(2.0f * std::log2(proxyCount)) + 2);
+    }
+
+    SUBCASE("Every overlapping pair is found by querying each proxy")
+    {
+        std::set<std::pair<int, int>> pairs;
+
+        for (std::size_t i = 0; i < proxies.ids.size(); i++) {
+            tree.query(proxies.aabbs[i], [&pairs, i](int userData) {
+                if (userData != static_cast<int>(i))
+                    pairs.insert(std::minmax(userData, static_cast<int>(i)));
+            });
+        }
+
+        for (std::size_t a = 0; a < proxies.aabbs.size(); a++) {
+            for (std::size_t b = a + 1; b < proxies.aabbs.size(); b++) {
+                if (proxies.aabbs[a].overlaps(proxies.aabbs[b]))
+                    REQUIRE(pairs.count({static_cast<int>(a), static_cast<int>(b)}) == 1);
+            }
+        }
+    }
+
+    SUBCASE("Ray casts find the proxies whose fat AABB is crossed")
+    {
+        std::uniform_real_distribution<float> position(-600.0f, 600.0f);
+
+        for (int rayCount = 0; rayCount < 100; rayCount++) {
+            // Some rays are horizontal or vertical
+            Vector2f from{position(engine), position(engine)};
+            Vector2f to{position(engine), position(engine)};
+            if (rayCount % 10 == 0)
+                to.y = from.y;
+            else if (rayCount % 10 == 1)
+                to.x = from.x;
+
+            std::multiset<int> found;
+            tree.rayCast(from, to, [&found](int userData) { found.insert(userData); });
+
+            for (std::size_t i = 0; i < proxies.ids.size(); i++) {
+                // The margins keep rounding errors at the edges of a box out of the comparison
+                const AABB& fatAABB = tree.getFatAABB(proxies.ids[i]);
+                if (isCrossed(grow(fatAABB, -0.01f), from, to))
+                    REQUIRE_EQ(found.count(static_cast<int>(i)), 1);
+                else if (!isCrossed(grow(fatAABB, 0.01f), from, to))
+                    REQUIRE_EQ(found.count(static_cast<int>(i)), 0);
+            }
+        }
+    }
+
+    SUBCASE("Clearing the tree removes every proxy")
+    {
+        tree.clear();
+
+        CHECK_EQ(tree.getProxyCount(), 0);
+        CHECK_EQ(tree.getHeight(), 0);
+
+        bool isFound = false;
+        tree.query(AABB{Vector2f{-1000.0f, -1000.0f}, Vector2f{1000.0f, 1000.0f}}, [&isFound](int) { isFound = true; });
+        CHECK_FALSE(isFound);
+    }
+}
@@ -0,0 +1,127 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/physics/CollisionDetector.h"
+#include "Mighter2d/core/physics/BoundingBoxBuffer.h"
+#include <doctest.h>
+#include <random>
+#include <vector>
+
+using mighter2d::BoundingBox;
+using mighter2d::Uint8;
+using mighter2d::Uint32;
+using mighter2d::Vector2f;
+using mighter2d::priv::BoundingBoxBuffer;
+using mighter2d::priv::CollisionDetector;
+
+namespace {
+    // Coordinates are whole numbers so that many bounding boxes share an edge
+    BoundingBox createRandomBoundingBox(std::mt19937& engine) {
+        std::uniform_int_distribution<int> position(0, 40);
+        std::uniform_int_distribution<int> size(0, 12);
+        return BoundingBox({static_cast<float>(position(engine)), static_cast<float>(position(engine))},
+                           {static_cast<float>(size(engine)), static_cast<float>(size(engine))});
+    }
+
+    std::vector<CollisionDetector::InstructionSet> getSupportedInstructionSets() {
+        std::vector<CollisionDetector::InstructionSet> instructionSets;
+        for (auto instructionSet : {CollisionDetector::InstructionSet::Scalar, CollisionDetector::InstructionSet::SSE2,
+                                    CollisionDetector::InstructionSet::AVX2})
+        {
+            if (instructionSet <= CollisionDetector::getBestInstructionSet())
+                instructionSets.push_back(instructionSet);
+        }
+
+        return instructionSets;
+    }
+}
+
+TEST_CASE("mighter2d::priv::CollisionDetector class")
+{
+    std::mt19937 engine(2036);
+
+    SUBCASE("Batched overlap tests match the single pair test with every instruction set")
+    {
+        for (auto instructionSet : getSupportedInstructionSets()) {
+            CollisionDetector::setInstructionSet(instructionSet);
+            REQUIRE(CollisionDetector::getInstructionSet() == instructionSet);
+
+            // Buffer sizes that are not a multiple of the vector width exercise the remainder loop
+            for (std::size_t size = 0; size < 40; size++) {
+                BoundingBoxBuffer boundingBoxes;
+                for (std::size_t i = 0; i < size; i++)
+                    boundingBoxes.add(createRandomBoundingBox(engine));
+
+                const BoundingBox boundingBox = createRandomBoundingBox(engine);
+                std::vector<Uint8> results(size + 1, 2);
+                CollisionDetector::isColliding(boundingBox, boundingBoxes, results.data());
+
+                for (std::size_t i = 0; i < size; i++)
+                    REQUIRE_EQ(results[i], CollisionDetector::isColliding(boundingBox, boundingBoxes.get(i)) ? 1 : 0);
+
+                // Nothing is written past the last bounding box
+                REQUIRE_EQ(results[size], 2);
+            }
+        }
+    }
+
+    SUBCASE("Batched pair tests match the single pair functions with every instruction set")
+    {
+        BoundingBoxBuffer boundingBoxes;
+        for (int i = 0; i < 64; i++)
+            boundingBoxes.add(createRandomBoundingBox(engine));
+
+        std::uniform_int_distribution<Uint32> index(0, 63);
+
+        for (auto instructionSet : getSupportedInstructionSets()) {
+            CollisionDetector::setInstructionSet(instructionSet);
+
+            for (std::size_t count = 0; count < 40; count++) {
+                std::vector<Uint32> indicesA(count), indicesB(count);
+                for (std::size_t i = 0; i < count; i++) {
+                    indicesA[i] = index(engine);
+                    indicesB[i] = index(engine);
+                }
+
+                std::vector<Uint8> isColliding(count + 1, 2);
+                std::vector<float> IoU(count + 1, -1.0f);
+                CollisionDetector::testPairs(boundingBoxes, indicesA.data(), indicesB.data(), count, isColliding.data(), IoU.data());
+
+                for (std::size_t i = 0; i < count; i++) {
+                    const BoundingBox boundingBoxA = boundingBoxes.get(indicesA[i]);
+                    const BoundingBox boundingBoxB = boundingBoxes.get(indicesB[i]);
+                    const bool isExpectedColliding = CollisionDetector::isColliding(boundingBoxA, boundingBoxB);
+
+                    REQUIRE_EQ(isColliding[i], isExpectedColliding ? 1 : 0);
+                    REQUIRE_EQ(IoU[i], doctest::Approx(isExpectedColliding ? CollisionDetector::getIoU(boundingBoxA, boundingBoxB) : 0.0f));
+                }
+
+                REQUIRE_EQ(isColliding[count], 2);
+                REQUIRE_EQ(IoU[count], -1.0f);
+            }
+        }
+    }
+
+    CollisionDetector::setInstructionSet(CollisionDetector::getBestInstructionSet());
+}
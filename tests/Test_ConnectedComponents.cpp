@@ -0,0 +1,165 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/scene/Scene.h"
+#include "Mighter2d/core/grid/Grid.h"
+#include "PathTestUtils.h"
+#include <doctest.h>
+#include <queue>
+#include <random>
+#include <vector>
+
+using namespace mighter2d;
+using namespace mighter2d::test;
+
+namespace {
+    std::vector<Index> getNeighbours(const Index& index) {
+        return {Index{index.row - 1, index.colm}, Index{index.row + 1, index.colm},
+                Index{index.row, index.colm - 1}, Index{index.row, index.colm + 1}};
+    }
+
+    // Reference flood fill, marks the tiles that are connected to the target
+    std::vector<bool> findConnectedTiles(const Grid& grid, const Index& target) {
+        const int colms = static_cast<int>(grid.getSizeInTiles().x);
+        std::vector<bool> isConnected(grid.getSizeInTiles().x * grid.getSizeInTiles().y, false);
+
+        if (!grid.isTileAccessible(target))
+            return isConnected;
+
+        std::queue<Index> openSet;
+        isConnected[static_cast<std::size_t>(target.row * colms + target.colm)] = true;
+        openSet.push(target);
+
+        while (!openSet.empty()) {
+            Index index = openSet.front();
+            openSet.pop();
+
+            for (const Index& neighbour : getNeighbours(index)) {
+                if (grid.isTileAccessible(neighbour) && !isConnected[static_cast<std::size_t>(neighbour.row * colms + neighbour.colm)]) {
+                    isConnected[static_cast<std::size_t>(neighbour.row * colms + neighbour.colm)] = true;
+                    openSet.push(neighbour);
+                }
+            }
+        }
+
+        return isConnected;
+    }
+
+    bool isReachable(const Grid& grid, const Index& source, const Index& target) {
+        const int colms = static_cast<int>(grid.getSizeInTiles().x);
+        const std::vector<bool> isConnected = findConnectedTiles(grid, target);
+
+        // A source that cannot be entered reaches the target through its neighbours
+        if (grid.isTileAccessible(source))
+            return isConnected[static_cast<std::size_t>(source.row * colms + source.colm)];
+
+        for (const Index& neighbour : getNeighbours(source)) {
+            if (grid.isTileAccessible(neighbour) && isConnected[static_cast<std::size_t>(neighbour.row * colms + neighbour.colm)])
+                return true;
+        }
+
+        return false;
+    }
+}
+
+TEST_CASE("Connected components of mighter2d::Grid")
+{
+    Scene scene;
+    Grid grid(32, 32, scene);
+    grid.construct({9, 5}, '.');
+
+    // A wall down the middle of the grid with a gap in row 2
+    for (int row = 0; row < 5; row++) {
+        if (row != 2)
+            grid.setCollidableByIndex(Index{row, 4}, true);
+    }
+
+    SUBCASE("Tiles on both sides of the gap are connected")
+    {
+        CHECK(grid.isReachable(Index{0, 0}, Index{4, 8}));
+        CHECK(grid.isReachable(Index{4, 8}, Index{0, 0}));
+    }
+
+    SUBCASE("Closing the gap splits a component")
+    {
+        CHECK(grid.isReachable(Index{0, 0}, Index{4, 8}));
+        grid.setCollidableByIndex(Index{2, 4}, true);
+
+        CHECK_FALSE(grid.isReachable(Index{0, 0}, Index{4, 8}));
+        CHECK_FALSE(grid.isReachable(Index{4, 8}, Index{0, 0}));
+        CHECK(grid.isReachable(Index{0, 0}, Index{4, 3}));
+        CHECK(grid.isReachable(Index{0, 5}, Index{4, 8}));
+    }
+
+    SUBCASE("Opening a gap merges two components")
+    {
+        grid.setCollidableByIndex(Index{2, 4}, true);
+        CHECK_FALSE(grid.isReachable(Index{0, 0}, Index{4, 8}));
+
+        grid.setCollidableByIndex(Index{0, 4}, false);
+        CHECK(grid.isReachable(Index{0, 0}, Index{4, 8}));
+        CHECK(grid.isReachable(Index{4, 8}, Index{4, 0}));
+    }
+
+    SUBCASE("A collidable target is not reachable")
+    {
+        CHECK_FALSE(grid.isReachable(Index{0, 0}, Index{0, 4}));
+    }
+
+    SUBCASE("A collidable source reaches the components of its neighbours")
+    {
+        grid.setCollidableByIndex(Index{2, 4}, true);
+        CHECK(grid.isReachable(Index{1, 4}, Index{0, 0}));
+        CHECK(grid.isReachable(Index{1, 4}, Index{4, 8}));
+    }
+
+    SUBCASE("Invalid indexes are not reachable")
+    {
+        CHECK_FALSE(grid.isReachable(Index{-1, 0}, Index{0, 0}));
+        CHECK_FALSE(grid.isReachable(Index{0, 0}, Index{5, 0}));
+    }
+
+    SUBCASE("Reachability matches a flood fill while tiles are split and merged")
+    {
+        std::mt19937 engine(2031);
+
+        std::uniform_int_distribution<unsigned int> size(1, 25);
+
+        for (int gridCount = 0; gridCount < 50; gridCount++) {
+            Grid randomGrid(32, 32, scene);
+            randomGrid.construct({size(engine), size(engine)}, '.');
+
+            for (int updateCount = 0; updateCount < 20; updateCount++) {
+                for (int changeCount = 0; changeCount < 8; changeCount++)
+                    randomGrid.setCollidableByIndex(getRandomIndex(randomGrid, engine), engine() % 3 != 0);
+
+                for (int checkCount = 0; checkCount < 10; checkCount++) {
+                    Index source = getRandomIndex(randomGrid, engine);
+                    Index target = getRandomIndex(randomGrid, engine);
+                    REQUIRE_EQ(randomGrid.isReachable(source, target), isReachable(randomGrid, source, target));
+                }
+            }
+        }
+    }
+}
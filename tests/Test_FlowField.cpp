@@ -0,0 +1,141 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/scene/Scene.h"
+#include "Mighter2d/core/grid/Grid.h"
+#include "Mighter2d/core/grid/FlowField.h"
+#include "PathTestUtils.h"
+#include <doctest.h>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace mighter2d;
+using namespace mighter2d::test;
+
+namespace {
+    const Index NO_TILE{-1, -1};
+
+    void checkFlowField(const Grid& grid, const FlowField& flowField) {
+        const int colms = static_cast<int>(grid.getSizeInTiles().x);
+        const int rows = static_cast<int>(grid.getSizeInTiles().y);
+        const std::vector<float> expectedCosts = findCheapestCosts(grid, flowField.getDestination(), false, true);
+        const FlowField newFlowField(grid, flowField.getDestination());
+
+        for (int row = 0; row < rows; row++) {
+            for (int colm = 0; colm < colms; colm++) {
+                const Index index{row, colm};
+
+                // A repaired flow field must match a flow field built from scratch
+                REQUIRE_EQ(flowField.getCost(index), doctest::Approx(newFlowField.getCost(index)));
+
+                if (!grid.isTileAccessible(index))
+                    continue;
+
+                const float expectedCost = expectedCosts[static_cast<std::size_t>(row * colms + colm)];
+                REQUIRE_EQ(flowField.getCost(index), doctest::Approx(expectedCost));
+                REQUIRE_EQ(flowField.isReachable(index), expectedCost >= 0.0f);
+
+                const Index next = flowField.getNextTile(index);
+                if (expectedCost <= 0.0f)
+                    REQUIRE_EQ(next, NO_TILE);
+                else {
+                    // The next tile is a neighbour on a cheapest path
+                    REQUIRE_EQ(std::abs(next.row - row) + std::abs(next.colm - colm), 1);
+                    REQUIRE(grid.isTileAccessible(next));
+                    REQUIRE_EQ(flowField.getCost(next) + grid.getMovementCost(next), doctest::Approx(expectedCost));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("mighter2d::FlowField class")
+{
+    SUBCASE("The flow field is repaired after obstacles are added")
+    {
+        std::mt19937 engine(2028);
+
+        for (int gridCount = 0; gridCount < 100; gridCount++) {
+            Scene scene;
+            Grid grid(32, 32, scene);
+            createRandomGrid(grid, engine, 25, false, true);
+
+            FlowField flowField(grid, getRandomIndex(grid, engine));
+
+            for (int changeCount = 0; changeCount < 10; changeCount++) {
+                grid.setCollidableByIndex(getRandomIndex(grid, engine), true);
+                flowField.update();
+                checkFlowField(grid, flowField);
+            }
+        }
+    }
+
+    SUBCASE("The flow field is repaired after obstacles are removed")
+    {
+        std::mt19937 engine(2029);
+
+        for (int gridCount = 0; gridCount < 100; gridCount++) {
+            Scene scene;
+            Grid grid(32, 32, scene);
+            createRandomGrid(grid, engine, 25, false, true);
+
+            for (int obstacleCount = 0; obstacleCount < 40; obstacleCount++)
+                grid.setCollidableByIndex(getRandomIndex(grid, engine), true);
+
+            FlowField flowField(grid, getRandomIndex(grid, engine));
+
+            for (int changeCount = 0; changeCount < 10; changeCount++) {
+                grid.setCollidableByIndex(getRandomIndex(grid, engine), false);
+                flowField.update();
+                checkFlowField(grid, flowField);
+            }
+        }
+    }
+
+    SUBCASE("The flow field is repaired after obstacles are added and removed between updates")
+    {
+        std::mt19937 engine(2030);
+
+        for (int gridCount = 0; gridCount < 100; gridCount++) {
+            Scene scene;
+            Grid grid(32, 32, scene);
+            createRandomGrid(grid, engine, 25, false, true);
+
+            const Index destination = getRandomIndex(grid, engine);
+            FlowField flowField(grid, destination);
+
+            for (int updateCount = 0; updateCount < 10; updateCount++) {
+                for (int changeCount = 0; changeCount < 5; changeCount++) {
+                    // Blocking the destination makes every tile unreachable until it is cleared
+                    Index index = engine() % 10 == 0 ? destination : getRandomIndex(grid, engine);
+                    grid.setCollidableByIndex(index, engine() % 2 == 0);
+                }
+
+                flowField.update();
+                checkFlowField(grid, flowField);
+            }
+        }
+    }
+}
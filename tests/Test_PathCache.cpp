@@ -0,0 +1,197 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/scene/Scene.h"
+#include "Mighter2d/core/grid/Grid.h"
+#include "Mighter2d/core/physics/path/PathCache.h"
+#include <doctest.h>
+#include <initializer_list>
+#include <stack>
+
+using namespace mighter2d;
+
+namespace {
+    // The first tile of the path is the first tile moved to
+    std::stack<Index> createPath(std::initializer_list<Index> tiles) {
+        std::stack<Index> path;
+        for (auto tile = std::rbegin(tiles); tile != std::rend(tiles); ++tile)
+            path.push(*tile);
+
+        return path;
+    }
+
+    PathCache::Key createKey(const Index& source, const Index& target, const std::string& settings = "Manhattan") {
+        return PathCache::Key{source, target, GridMover::MoveRestriction::None, "AStar", settings};
+    }
+}
+
+TEST_CASE("mighter2d::PathCache class")
+{
+    Scene scene;
+    Grid grid(32, 32, scene);
+    grid.construct({10, 10}, '.');
+
+    PathCache pathCache(3);
+    const PathCache::Key keyA = createKey(Index{0, 0}, Index{0, 2});
+    const PathCache::Key keyB = createKey(Index{1, 0}, Index{1, 2});
+    const PathCache::Key keyC = createKey(Index{2, 0}, Index{2, 2});
+    const PathCache::Key keyD = createKey(Index{3, 0}, Index{3, 2});
+
+    SUBCASE("Inserted paths are found with the same key")
+    {
+        pathCache.insert(grid, keyA, createPath({Index{0, 1}, Index{0, 2}}));
+
+        const std::stack<Index>* path = pathCache.find(grid, keyA);
+        REQUIRE(path);
+        CHECK(*path == createPath({Index{0, 1}, Index{0, 2}}));
+        CHECK_EQ(pathCache.getHitCount(), 1);
+        CHECK_EQ(pathCache.getMissCount(), 0);
+    }
+
+    SUBCASE("Paths are not found with the settings of another path finder")
+    {
+        pathCache.insert(grid, keyA, createPath({Index{0, 1}, Index{0, 2}}));
+
+        CHECK_FALSE(pathCache.find(grid, createKey(keyA.source, keyA.target, "Octile")));
+        CHECK_EQ(pathCache.getMissCount(), 1);
+    }
+
+    SUBCASE("Inserting a path with the same key replaces the path")
+    {
+        pathCache.insert(grid, keyA, createPath({Index{0, 1}, Index{0, 2}}));
+        pathCache.insert(grid, keyA, createPath({Index{1, 0}, Index{1, 1}, Index{0, 1}, Index{0, 2}}));
+
+        CHECK_EQ(pathCache.getSize(), 1);
+        REQUIRE(pathCache.find(grid, keyA));
+        CHECK_EQ(pathCache.find(grid, keyA)->size(), 4);
+    }
+
+    SUBCASE("The least recently used path is evicted when the cache is full")
+    {
+        pathCache.insert(grid, keyA, createPath({Index{0, 1}, Index{0, 2}}));
+        pathCache.insert(grid, keyB, createPath({Index{1, 1}, Index{1, 2}}));
+        pathCache.insert(grid, keyC, createPath({Index{2, 1}, Index{2, 2}}));
+
+        // Finding A makes B the least recently used path
+        CHECK(pathCache.find(grid, keyA));
+        pathCache.insert(grid, keyD, createPath({Index{3, 1}, Index{3, 2}}));
+
+        CHECK_EQ(pathCache.getSize(), 3);
+        CHECK_FALSE(pathCache.find(grid, keyB));
+        CHECK(pathCache.find(grid, keyA));
+        CHECK(pathCache.find(grid, keyC));
+        CHECK(pathCache.find(grid, keyD));
+    }
+
+    SUBCASE("Reducing the capacity evicts the least recently used paths")
+    {
+        pathCache.insert(grid, keyA, createPath({Index{0, 1}, Index{0, 2}}));
+        pathCache.insert(grid, keyB, createPath({Index{1, 1}, Index{1, 2}}));
+        pathCache.insert(grid, keyC, createPath({Index{2, 1}, Index{2, 2}}));
+        CHECK(pathCache.find(grid, keyA));
+
+        pathCache.setCapacity(2);
+
+        CHECK_EQ(pathCache.getCapacity(), 2);
+        CHECK_EQ(pathCache.getSize(), 2);
+        CHECK_FALSE(pathCache.find(grid, keyB));
+        CHECK(pathCache.find(grid, keyA));
+        CHECK(pathCache.find(grid, keyC));
+    }
+
+    SUBCASE("Only the paths crossing a changed tile are removed")
+    {
+        pathCache.insert(grid, keyA, createPath({Index{0, 1}, Index{0, 2}}));
+        pathCache.insert(grid, keyB, createPath({Index{1, 1}, Index{1, 2}}));
+
+        grid.setCollidableByIndex(Index{0, 1}, true);
+
+        CHECK_FALSE(pathCache.find(grid, keyA));
+        CHECK(pathCache.find(grid, keyB));
+        CHECK_EQ(pathCache.getSize(), 1);
+    }
+
+    SUBCASE("Paths moving diagonally past a changed tile are removed")
+    {
+        const PathCache::Key key = createKey(Index{0, 0}, Index{2, 2});
+        pathCache.insert(grid, key, createPath({Index{1, 1}, Index{2, 2}}));
+
+        grid.setCollidableByIndex(Index{1, 2}, true);
+
+        CHECK_FALSE(pathCache.find(grid, key));
+    }
+
+    SUBCASE("Paths away from a changed tile are kept")
+    {
+        pathCache.insert(grid, keyA, createPath({Index{0, 1}, Index{0, 2}}));
+
+        grid.setCollidableByIndex(Index{9, 9}, true);
+
+        CHECK(pathCache.find(grid, keyA));
+    }
+
+    SUBCASE("Paths around a freed tile are removed")
+    {
+        // Key A detours around a wall
+        grid.setCollidableByIndex(Index{0, 1}, true);
+        grid.setCollidableByIndex(Index{1, 1}, true);
+        pathCache.insert(grid, keyA, createPath({Index{1, 0}, Index{2, 0}, Index{2, 1}, Index{2, 2}, Index{1, 2}, Index{0, 2}}));
+
+        const PathCache::Key key = createKey(Index{9, 0}, Index{9, 2});
+        pathCache.insert(grid, key, createPath({Index{9, 1}, Index{9, 2}}));
+
+        grid.setCollidableByIndex(Index{1, 1}, false);
+
+        CHECK_FALSE(pathCache.find(grid, keyA));
+        CHECK(pathCache.find(grid, key));
+    }
+
+    SUBCASE("Empty paths are removed when their target becomes reachable")
+    {
+        // Wall off the target of key A
+        grid.setCollidableByIndex(Index{0, 1}, true);
+        grid.setCollidableByIndex(Index{1, 2}, true);
+        grid.setCollidableByIndex(Index{0, 3}, true);
+        pathCache.insert(grid, keyA, std::stack<Index>{});
+        REQUIRE(pathCache.find(grid, keyA));
+
+        // A change that keeps the target unreachable keeps the empty path
+        grid.setCollidableByIndex(Index{9, 9}, true);
+        CHECK(pathCache.find(grid, keyA));
+
+        grid.setCollidableByIndex(Index{1, 2}, false);
+        CHECK_FALSE(pathCache.find(grid, keyA));
+    }
+
+    SUBCASE("The cache is emptied when it is used with another grid")
+    {
+        pathCache.insert(grid, keyA, createPath({Index{0, 1}, Index{0, 2}}));
+
+        Grid otherGrid(32, 32, scene);
+        otherGrid.construct({10, 10}, '.');
+
+        CHECK_FALSE(pathCache.find(otherGrid, keyA));
+        CHECK_EQ(pathCache.getSize(), 0);
+    }
+}
@@ -0,0 +1,226 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/scene/Scene.h"
+#include "Mighter2d/core/grid/Grid.h"
+#include "Mighter2d/core/physics/path/AStar.h"
+#include "Mighter2d/core/physics/path/JPS.h"
+#include "Mighter2d/core/physics/path/HPAStar.h"
+#include "PathTestUtils.h"
+#include <doctest.h>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <stack>
+
+using namespace mighter2d;
+using namespace mighter2d::test;
+
+namespace {
+    const float UNREACHABLE = -1.0f;
+    const float INVALID_PATH = -2.0f;
+
+    // Returns the cheapest cost from source to target
+    float findCheapestCost(const Grid& grid, const Index& source, const Index& target, bool isDiagonalAllowed) {
+        if (!grid.isTileAccessible(target))
+            return UNREACHABLE;
+
+        const int colms = static_cast<int>(grid.getSizeInTiles().x);
+        float cost = findCheapestCosts(grid, source, isDiagonalAllowed, false)[static_cast<std::size_t>(target.row * colms + target.colm)];
+        return cost < 0.0f ? UNREACHABLE : cost;
+    }
+
+    // Returns the cost of a path or INVALID_PATH if it does not lead from source to target in valid moves
+    float getPathCost(const Grid& grid, const Index& source, const Index& target, std::stack<Index> path, bool isDiagonalAllowed) {
+        if (path.empty())
+            return UNREACHABLE;
+
+        float cost = 0.0f;
+        Index current = source;
+
+        while (!path.empty()) {
+            Index next = path.top();
+            path.pop();
+
+            int rowDistance = std::abs(next.row - current.row);
+            int colmDistance = std::abs(next.colm - current.colm);
+            bool isDiagonal = rowDistance == 1 && colmDistance == 1;
+
+            if (rowDistance > 1 || colmDistance > 1 || rowDistance + colmDistance == 0 || !grid.isTileAccessible(next))
+                return INVALID_PATH;
+
+            if (isDiagonal && (!isDiagonalAllowed || !isDiagonalMoveValid(grid, current, next)))
+                return INVALID_PATH;
+
+            cost += grid.getMovementCost(next) * (isDiagonal ? DIAGONAL_COST : 1.0f);
+            current = next;
+        }
+
+        return current == target ? cost : INVALID_PATH;
+    }
+
+    using FindPath = std::function<std::stack<Index>(const Grid&, const Index&, const Index&)>;
+
+    // Checks the paths of a path finder against the cheapest paths on random grids
+    void checkPathCosts(unsigned int seed, bool isWeighted, bool isDiagonalAllowed, bool isOptimal,
+        const std::function<FindPath(const Vector2u&)>& createPathFinder)
+    {
+        std::mt19937 engine(seed);
+
+        for (int gridCount = 0; gridCount < 100; gridCount++) {
+            Scene scene;
+            Grid grid(32, 32, scene);
+            createRandomGrid(grid, engine, 30, true, isWeighted);
+            FindPath findPath = createPathFinder(grid.getSizeInTiles());
+
+            for (int pathCount = 0; pathCount < 10; pathCount++) {
+                Index source = getRandomIndex(grid, engine);
+                Index target = getRandomIndex(grid, engine);
+
+                if (source == target)
+                    continue;
+
+                float expectedCost = findCheapestCost(grid, source, target, isDiagonalAllowed);
+                float cost = getPathCost(grid, source, target, findPath(grid, source, target), isDiagonalAllowed);
+
+                REQUIRE_NE(cost, INVALID_PATH);
+
+                if (expectedCost == UNREACHABLE)
+                    CHECK_EQ(cost, UNREACHABLE);
+                else if (isOptimal)
+                    CHECK_EQ(cost, doctest::Approx(expectedCost).epsilon(0.0001));
+                else {
+                    REQUIRE_NE(cost, UNREACHABLE);
+                    CHECK_GE(cost, expectedCost - 0.001f);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("mighter2d::AStar class")
+{
+    SUBCASE("Paths are the cheapest paths when only horizontal and vertical moves are allowed")
+    {
+        checkPathCosts(2022, true, false, true, [](const Vector2u& gridSize) -> FindPath {
+            auto aStar = std::make_shared<AStar>(gridSize, AStar::Heuristic::Manhattan);
+            return [aStar](const Grid& grid, const Index& source, const Index& target) {
+                return aStar->findPath(grid, source, target);
+            };
+        });
+    }
+
+    SUBCASE("Paths are the cheapest paths when diagonal moves are allowed")
+    {
+        checkPathCosts(2023, true, true, true, [](const Vector2u& gridSize) -> FindPath {
+            auto aStar = std::make_shared<AStar>(gridSize, AStar::Heuristic::Octile);
+            return [aStar](const Grid& grid, const Index& source, const Index& target) {
+                return aStar->findPath(grid, source, target);
+            };
+        });
+    }
+
+    SUBCASE("No path is found to a collidable tile")
+    {
+        Scene scene;
+        Grid grid(32, 32, scene);
+        grid.construct({10, 10}, '.');
+        grid.setCollidableByIndex(Index{5, 5}, true);
+
+        AStar aStar(grid.getSizeInTiles());
+        CHECK(aStar.findPath(grid, Index{0, 0}, Index{5, 5}).empty());
+    }
+}
+
+TEST_CASE("mighter2d::JPS class")
+{
+    SUBCASE("Paths are the shortest paths when only horizontal and vertical moves are allowed")
+    {
+        checkPathCosts(2024, false, false, true, [](const Vector2u& gridSize) -> FindPath {
+            auto jps = std::make_shared<JPS>(gridSize, GridMover::MoveRestriction::NonDiagonal);
+            return [jps](const Grid& grid, const Index& source, const Index& target) {
+                return jps->findPath(grid, source, target);
+            };
+        });
+    }
+
+    SUBCASE("Paths are the shortest paths when diagonal moves are allowed")
+    {
+        checkPathCosts(2025, false, true, true, [](const Vector2u& gridSize) -> FindPath {
+            auto jps = std::make_shared<JPS>(gridSize, GridMover::MoveRestriction::None);
+            return [jps](const Grid& grid, const Index& source, const Index& target) {
+                return jps->findPath(grid, source, target);
+            };
+        });
+    }
+}
+
+TEST_CASE("mighter2d::HPAStar class")
+{
+    SUBCASE("A path is found whenever the target is reachable")
+    {
+        // HPA* trades optimality for speed, its paths may be longer than the cheapest path
+        checkPathCosts(2026, true, false, false, [](const Vector2u& gridSize) -> FindPath {
+            auto hpaStar = std::make_shared<HPAStar>(gridSize, 4);
+            return [hpaStar](const Grid& grid, const Index& source, const Index& target) {
+                return hpaStar->findPath(grid, source, target);
+            };
+        });
+    }
+
+    SUBCASE("Paths found after the grid changes are the same as the paths of a new instance")
+    {
+        std::mt19937 engine(2027);
+        std::uniform_int_distribution<unsigned int> clusterSize(1, 12);
+
+        for (int gridCount = 0; gridCount < 50; gridCount++) {
+            Scene scene;
+            Grid grid(32, 32, scene);
+            createRandomGrid(grid, engine, 30, true, gridCount % 2 == 0);
+
+            const unsigned int size = clusterSize(engine);
+            HPAStar hpaStar(grid.getSizeInTiles(), size);
+
+            for (int pathCount = 0; pathCount < 10; pathCount++) {
+                for (int changeCount = 0; changeCount < 3; changeCount++)
+                    grid.setCollidableByIndex(getRandomIndex(grid, engine), engine() % 2 == 0);
+
+                Index source = getRandomIndex(grid, engine);
+                Index target = getRandomIndex(grid, engine);
+
+                if (source == target)
+                    continue;
+
+                std::stack<Index> path = hpaStar.findPath(grid, source, target);
+                float expectedCost = findCheapestCost(grid, source, target, false);
+                float cost = getPathCost(grid, source, target, path, false);
+
+                REQUIRE_NE(cost, INVALID_PATH);
+                CHECK_EQ(cost == UNREACHABLE, expectedCost == UNREACHABLE);
+                CHECK(path == HPAStar(grid.getSizeInTiles(), size).findPath(grid, source, target));
+            }
+        }
+    }
+}
@@ -0,0 +1,190 @@
+// ///////////////////////////////////////////////////////////////////////////
+//  Mighter2d
+//
+//  Copyright (c) 2023 Kwena Mashamaite
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+// ///////////////////////////////////////////////////////////////////////////
+
+#include "Mighter2d/core/physics/SpatialHash.h"
+#include <doctest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using mighter2d::BoundingBox;
+using mighter2d::Vector2f;
+using mighter2d::priv::SpatialHash;
+
+namespace {
+    struct CellRange {
+        float left, top, right, bottom;
+    };
+
+    CellRange getCellRange(const BoundingBox& boundingBox, float cellSize) {
+        const Vector2f& pos = boundingBox.getPosition();
+        const Vector2f& size = boundingBox.getSize();
+        return CellRange{std::floor(pos.x / cellSize), std::floor(pos.y / cellSize),
+                         std::floor((pos.x + size.x) / cellSize), std::floor((pos.y + size.y) / cellSize)};
+    }
+
+    // Proxies touching more than 64 cells are paired with every other proxy
+    bool isOversized(const CellRange& range) {
+        return (range.right - range.left + 1.0f) * (range.bottom - range.top + 1.0f) > 64.0f;
+    }
+
+    bool isOverlapping(const BoundingBox& a, const BoundingBox& b) {
+        return a.getPosition().x <= b.getPosition().x + b.getSize().x && b.getPosition().x <= a.getPosition().x + a.getSize().x
+            && a.getPosition().y <= b.getPosition().y + b.getSize().y && b.getPosition().y <= a.getPosition().y + a.getSize().y;
+    }
+
+    // Brute force reference: the pairs of proxies that share a cell and involve one of the given proxies
+    std::vector<SpatialHash::Pair> findPairs(const std::vector<BoundingBox>& boundingBoxes, const std::vector<bool>& isInUse,
+        const std::vector<int>& proxyIds, float cellSize)
+    {
+        std::vector<SpatialHash::Pair> pairs;
+
+        for (int a = 0; a < static_cast<int>(boundingBoxes.size()); a++) {
+            for (int b = a + 1; b < static_cast<int>(boundingBoxes.size()); b++) {
+                bool isGiven = std::find(proxyIds.begin(), proxyIds.end(), a) != proxyIds.end()
+                    || std::find(proxyIds.begin(), proxyIds.end(), b) != proxyIds.end();
+
+                if (!isGiven || !isInUse[static_cast<std::size_t>(a)] || !isInUse[static_cast<std::size_t>(b)])
+                    continue;
+
+                CellRange rangeA = getCellRange(boundingBoxes[static_cast<std::size_t>(a)], cellSize);
+                CellRange rangeB = getCellRange(boundingBoxes[static_cast<std::size_t>(b)], cellSize);
+                bool isSharingCell = rangeA.left <= rangeB.right && rangeB.left <= rangeA.right
+                    && rangeA.top <= rangeB.bottom && rangeB.top <= rangeA.bottom;
+
+                if (isSharingCell || isOversized(rangeA) || isOversized(rangeB))
+                    pairs.emplace_back(a, b);
+            }
+        }
+
+        return pairs;
+    }
+
+    BoundingBox createRandomBoundingBox(std::mt19937& engine) {
+        std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+        std::uniform_real_distribution<float> size(0.0f, 120.0f);
+        std::uniform_real_distribution<float> largeSize(0.0f, 1000.0f);
+
+        // Some bounding boxes are large enough to be oversized
+        bool isLarge = engine() % 20 == 0;
+        return BoundingBox({position(engine), position(engine)},
+            isLarge ? Vector2f{largeSize(engine), largeSize(engine)} : Vector2f{size(engine), size(engine)});
+    }
+}
+
+TEST_CASE("mighter2d::priv::SpatialHash class")
+{
+    SUBCASE("Pairs match a brute force search as proxies are added, moved and removed")
+    {
+        std::mt19937 engine(2032);
+
+        for (int hashCount = 0; hashCount < 20; hashCount++) {
+            const float cellSize = std::uniform_real_distribution<float>(16.0f, 128.0f)(engine);
+            SpatialHash spatialHash(cellSize);
+            std::vector<BoundingBox> boundingBoxes(100);
+            std::vector<bool> isInUse(100, false);
+
+            for (int step = 0; step < 30; step++) {
+                std::vector<int> changedProxyIds;
+
+                for (int changeCount = 0; changeCount < 10; changeCount++) {
+                    int proxyId = static_cast<int>(engine() % boundingBoxes.size());
+
+                    if (isInUse[static_cast<std::size_t>(proxyId)] && engine() % 4 == 0) {
+                        spatialHash.remove(proxyId);
+                        isInUse[static_cast<std::size_t>(proxyId)] = false;
+                    } else {
+                        boundingBoxes[static_cast<std::size_t>(proxyId)] = createRandomBoundingBox(engine);
+                        spatialHash.update(proxyId, boundingBoxes[static_cast<std::size_t>(proxyId)]);
+                        isInUse[static_cast<std::size_t>(proxyId)] = true;
+                    }
+
+                    changedProxyIds.push_back(proxyId);
+                }
+
+                std::vector<SpatialHash::Pair> pairs;
+                spatialHash.findPairs(changedProxyIds, pairs);
+                REQUIRE(pairs == findPairs(boundingBoxes, isInUse, changedProxyIds, cellSize));
+            }
+        }
+    }
+
+    SUBCASE("Every overlapping pair is found")
+    {
+        std::mt19937 engine(2033);
+        SpatialHash spatialHash(64.0f);
+        std::vector<BoundingBox> boundingBoxes;
+        std::vector<int> proxyIds;
+
+        for (int proxyId = 0; proxyId < 300; proxyId++) {
+            boundingBoxes.push_back(createRandomBoundingBox(engine));
+            spatialHash.update(proxyId, boundingBoxes.back());
+            proxyIds.push_back(proxyId);
+        }
+
+        std::vector<SpatialHash::Pair> pairs;
+        spatialHash.findPairs(proxyIds, pairs);
+
+        for (int a = 0; a < static_cast<int>(boundingBoxes.size()); a++) {
+            for (int b = a + 1; b < static_cast<int>(boundingBoxes.size()); b++) {
+                if (isOverlapping(boundingBoxes[static_cast<std::size_t>(a)], boundingBoxes[static_cast<std::size_t>(b)]))
+                    REQUIRE(std::binary_search(pairs.begin(), pairs.end(), SpatialHash::Pair{a, b}));
+            }
+        }
+    }
+
+    SUBCASE("Changing the cell size rehashes the proxies")
+    {
+        std::mt19937 engine(2034);
+        SpatialHash spatialHash(32.0f);
+        std::vector<BoundingBox> boundingBoxes;
+        std::vector<int> proxyIds;
+
+        for (int proxyId = 0; proxyId < 100; proxyId++) {
+            boundingBoxes.push_back(createRandomBoundingBox(engine));
+            spatialHash.update(proxyId, boundingBoxes.back());
+            proxyIds.push_back(proxyId);
+        }
+
+        spatialHash.setCellSize(100.0f);
+        CHECK_EQ(spatialHash.getCellSize(), 100.0f);
+
+        std::vector<SpatialHash::Pair> pairs;
+        spatialHash.findPairs(proxyIds, pairs);
+        CHECK(pairs == findPairs(boundingBoxes, std::vector<bool>(boundingBoxes.size(), true), proxyIds, 100.0f));
+    }
+
+    SUBCASE("Removed proxies are not paired")
+    {
+        SpatialHash spatialHash(64.0f);
+        spatialHash.update(0, BoundingBox({0.0f, 0.0f}, {10.0f, 10.0f}));
+        spatialHash.update(1, BoundingBox({5.0f, 5.0f}, {10.0f, 10.0f}));
+        spatialHash.remove(1);
+
+        std::vector<SpatialHash::Pair> pairs;
+        spatialHash.findPairs({0, 1}, pairs);
+        CHECK(pairs.empty());
+    }
+}